@@ -78,6 +78,25 @@ namespace fastgltf::base64 {
     void fallback_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
     FASTGLTF_EXPORT void decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
 
+    /**
+     * The amount of encoded characters each task of parallel_decode_inplace decodes. This is a multiple of the
+     * block sizes of all SIMD decoders, so that no decoder writes past the output of its own chunk.
+     */
+    FASTGLTF_EXPORT inline constexpr std::size_t parallelDecodeChunkSize = 96 * 16384;
+
+    /**
+     * Encoded data smaller than this is always decoded on the calling thread by parallel_decode_inplace.
+     */
+    FASTGLTF_EXPORT inline constexpr std::size_t parallelDecodeThreshold = 4 * 1024 * 1024;
+
+    /**
+     * Splits the encoded data into chunks of parallelDecodeChunkSize characters and decodes each of them
+     * as a separate task using the given callback, with the fastest decoder available on this system.
+     * Data smaller than the threshold, or when no callback is given, is decoded using decode_inplace.
+     */
+    FASTGLTF_EXPORT void parallel_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding,
+			ParallelTaskCallback* taskCallback, void* userPointer, std::size_t threshold = parallelDecodeThreshold);
+
     [[nodiscard]] StaticVector<std::uint8_t> fallback_decode(std::string_view encoded);
     FASTGLTF_EXPORT [[nodiscard]] StaticVector<std::uint8_t> decode(std::string_view encoded);
 } // namespace fastgltf::base64
@@ -34,6 +34,14 @@
 
 #include <fastgltf/types.hpp>
 
+#ifndef FASTGLTF_ENABLE_STATISTICS
+#define FASTGLTF_ENABLE_STATISTICS 0
+#endif
+
+#if FASTGLTF_ENABLE_STATISTICS && (!defined(FASTGLTF_USE_STD_MODULE) || !FASTGLTF_USE_STD_MODULE)
+#include <chrono>
+#endif
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 5030) // attribute 'x' is not recognized
@@ -91,6 +99,7 @@ namespace fastgltf {
 		InvalidFileData = 12, ///< The file data is invalid, or the file type could not be determined.
 		FailedWritingFiles = 13, ///< The exporter failed to write some files (buffers/images) to disk.
 		FileBufferAllocationFailed = 14, ///< The constructor of GltfDataBuffer failed to allocate a sufficiently large buffer.
+		InvalidCompressedData = 15, ///< A compressed buffer view could not be decompressed, or its buffer data was not loaded.
     };
 
 	FASTGLTF_EXPORT constexpr std::string_view getErrorName(Error error) {
@@ -110,6 +119,7 @@ namespace fastgltf {
             case Error::InvalidFileData: return "InvalidFileData";
             case Error::FailedWritingFiles: return "FailedWritingFiles";
 			case Error::FileBufferAllocationFailed: return "FileBufferAllocationFailed";
+			case Error::InvalidCompressedData: return "InvalidCompressedData";
 			default: FASTGLTF_UNREACHABLE
 		}
 	}
@@ -131,6 +141,7 @@ namespace fastgltf {
             case Error::InvalidFileData: return "The file data is invalid, or the file type could not be determined.";
             case Error::FailedWritingFiles: return "The exporter failed to write some files (buffers/images) to disk.";
 			case Error::FileBufferAllocationFailed: return "The constructor of GltfDataBuffer failed to allocate a sufficiently large buffer.";
+			case Error::InvalidCompressedData: return "A compressed buffer view could not be decompressed, or its buffer data was not loaded.";
 			default: FASTGLTF_UNREACHABLE
 		}
 	}
@@ -279,11 +290,85 @@ namespace fastgltf {
         LoadExternalImages              = 1 << 7,
 
 		/**
-		 * Lets fastgltf generate indices for all mesh primitives without indices. This currently
-		 * does not de-duplicate the vertices. This is entirely for compatibility and simplifying the
-		 * loading process.
+		 * Lets fastgltf generate indices for all mesh primitives without indices. This does not
+		 * de-duplicate the vertices, unless WeldGeneratedMeshIndices is also specified. This is
+		 * entirely for compatibility and simplifying the loading process. All generated data is
+		 * written into a single new buffer. Every primitive gets its own index accessor, but the
+		 * accessors of all primitives with the trivial index sequence share the same buffer view range.
 		 */
 		GenerateMeshIndices             = 1 << 8,
+
+		/**
+		 * When loading a GLB from a data getter which can share its memory, like MappedGltfFile, the
+		 * GLB buffer is not copied, but exposed as a sources::ByteView pointing into the mapped file.
+		 * The Asset keeps the mapping alive, even after the MappedGltfFile has been destroyed.
+		 * For all other data getters, this option has no effect.
+		 */
+		MapGLBBuffer                    = 1 << 9,
+
+		/**
+		 * Memory maps external files loaded through LoadExternalBuffers or LoadExternalImages instead
+		 * of reading them into CPU memory. These are then exposed as a sources::ByteView pointing into
+		 * the mapping, which the Asset keeps alive. Buffers and images referencing the same file share
+		 * a single mapping. This option has no effect if FASTGLTF_HAS_MEMORY_MAPPED_FILE is not defined.
+		 */
+		MapExternalFiles                = 1 << 10,
+
+		/**
+		 * Collects all external files loaded through LoadExternalBuffers or LoadExternalImages while
+		 * parsing, and reads them afterwards with io_uring, submitting all reads in a single batch.
+		 * If io_uring is not available at runtime, the files are read using pread instead. Without
+		 * FASTGLTF_HAS_IO_URING, the files are simply loaded one after another after parsing.
+		 */
+		BatchExternalFileReads          = 1 << 11,
+
+		/**
+		 * Only parses the JSON chunk of a GLB and does not read the BIN chunk. Instead, the GLB buffer
+		 * is recorded as a sources::URI with an empty URI, referring to the GLB file itself, whose
+		 * fileByteOffset points to the start of the BIN chunk data. The chunk is skipped using
+		 * GltfDataGetter::skip, which lets e.g. GltfFileStream seek past it without reading it.
+		 * This is useful when only the metadata of a GLB file is of interest.
+		 */
+		DeferGLBBuffer                  = 1 << 12,
+
+		/**
+		 * When only some categories are requested, the JSON is first walked with simdjson's On-Demand
+		 * API, which skips over the arrays of all categories that are not requested without building
+		 * a tape for them. Only the remaining part of the document is then parsed into a DOM, which
+		 * reduces memory usage and parse time for partial loads. The resulting Asset is the same,
+		 * though syntax errors within skipped arrays might go unnoticed.
+		 */
+		OnDemandParsing                 = 1 << 13,
+
+		/**
+		 * Decompresses all buffer views using EXT_meshopt_compression with the built-in decoder while
+		 * loading. Every decompressed view gets its own new sources::Array buffer, is repointed to it,
+		 * and its meshoptCompression is reset, so that the accessor tools can read it like any other
+		 * buffer view. This requires the compressed buffers to be loaded into memory, e.g. by also
+		 * specifying LoadExternalBuffers.
+		 */
+		DecompressMeshoptBuffers        = 1 << 14,
+
+		/**
+		 * When used together with GenerateMeshIndices, identical vertices of primitives without
+		 * indices are welded together. The bytes of all attributes of a primitive, including its
+		 * morph targets, are compared, and the unique vertices are written into the generated
+		 * buffer with new buffer views and accessors, which replace the attributes of the primitive.
+		 * The generated indices then refer to the unique vertices. This requires the attribute data
+		 * to be in memory, and primitives for which it is not are only given the trivial indices.
+		 */
+		WeldGeneratedMeshIndices        = 1 << 15,
+
+		/**
+		 * Optimizes all indexed triangle list primitives for rendering after loading, including those
+		 * with indices from GenerateMeshIndices. The triangles are reordered for the post-transform
+		 * vertex cache using optimizeVertexCache, and the vertices are then reordered in the order
+		 * they are first used, unless the attribute accessors are shared with another primitive. The
+		 * new indices and vertices are written into a single new buffer, with new buffer views and
+		 * accessors, which replace those of the primitives. Primitives for which the data is not in
+		 * memory are left untouched.
+		 */
+		OptimizeMeshes                  = 1 << 16,
     };
 
     FASTGLTF_EXPORT enum class ExportOptions : std::uint64_t {
@@ -550,6 +635,12 @@ namespace fastgltf {
 		 */
 		[[nodiscard]] virtual span<std::byte> read(std::size_t count, std::size_t padding) = 0;
 
+		/**
+		 * Advances the offset by count bytes without using the data. The default implementation
+		 * reads and discards the data, while implementations that can seek should override this.
+		 */
+		virtual void skip(std::size_t count);
+
 		/**
 		 * Reset is used to put the offset index back to the start of the buffer/file.
 		 * This is only necessary for functionality like determineGltfFileType. However, reset()
@@ -559,6 +650,23 @@ namespace fastgltf {
 
 		[[nodiscard]] virtual std::size_t bytesRead() = 0;
 		[[nodiscard]] virtual std::size_t totalSize() = 0;
+
+		/**
+		 * Returns an object which keeps the memory returned by read(count, padding) alive, even after
+		 * this data getter has been destroyed. Implementations that cannot provide this return nullptr,
+		 * in which case the parser always copies the data it needs to keep.
+		 */
+		[[nodiscard]] virtual std::shared_ptr<const void> getSharedStorage() {
+			return nullptr;
+		}
+
+		/**
+		 * Returns an error if one of the previous reads could not read all requested bytes, e.g. because
+		 * the underlying file is truncated or unreadable. The parser checks this after reading each chunk.
+		 */
+		[[nodiscard]] virtual Error readError() const noexcept {
+			return Error::None;
+		}
 	};
 
 	FASTGLTF_EXPORT class GltfDataBuffer : public GltfDataGetter {
@@ -618,6 +726,8 @@ namespace fastgltf {
 
 		[[nodiscard]] span<std::byte> read(std::size_t count, std::size_t padding) override;
 
+		void skip(std::size_t count) override;
+
 		void reset() override;
 
 		[[nodiscard]] std::size_t bytesRead() override;
@@ -636,12 +746,10 @@ namespace fastgltf {
 	 * You should check for FASTGLTF_HAS_MEMORY_MAPPED_FILE before using this class.
 	 */
 	FASTGLTF_EXPORT class MappedGltfFile : public GltfDataGetter {
+		// Owns the mapping and unmaps the file once the last reference is gone. This is shared
+		// with assets loaded using Options::MapGLBBuffer.
+		std::shared_ptr<void> mapping;
 		void* mappedFile = nullptr;
-#if defined(_WIN32)
-		// Windows requires us to keep the file handle alive. Win32 HANDLE is a void*.
-		void* fileHandle = nullptr;
-		void* fileMapping = nullptr;
-#endif
 		std::uint64_t fileSize = 0;
 
 		std::size_t idx = 0;
@@ -671,12 +779,16 @@ namespace fastgltf {
 
 		[[nodiscard]] span<std::byte> read(std::size_t count, std::size_t padding) override;
 
+		void skip(std::size_t count) override;
+
 		void reset() override;
 
 		[[nodiscard]] std::size_t bytesRead() override;
 
 		[[nodiscard]] std::size_t totalSize() override;
 
+		[[nodiscard]] std::shared_ptr<const void> getSharedStorage() override;
+
 		[[nodiscard]] explicit operator span<std::byte>() {
 			return span<std::byte>(static_cast<std::byte*>(mappedFile), fileSize);
 		}
@@ -699,12 +811,78 @@ namespace fastgltf {
 
 		[[nodiscard]] span<std::byte> read(std::size_t count, std::size_t padding) override;
 
+		void skip(std::size_t count) override;
+
+		void reset() override;
+
+		[[nodiscard]] std::size_t bytesRead() override;
+
+		[[nodiscard]] std::size_t totalSize() override;
+	};
+
+#if defined(__linux__) && !defined(__ANDROID__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define FASTGLTF_HAS_IO_URING 1
+#endif
+#endif
+
+#if defined(FASTGLTF_HAS_IO_URING)
+	class IoUring;
+
+	/**
+	 * Reads a file using io_uring, falling back to pread if io_uring is not available at runtime.
+	 * On construction, the first 64 KiB of the file are read ahead with a single request, which
+	 * usually covers the GLB header and the entire JSON chunk.
+	 * You should check for FASTGLTF_HAS_IO_URING before using this class.
+	 */
+	FASTGLTF_EXPORT class IoUringGltfFile : public GltfDataGetter {
+		int fileDescriptor = -1;
+		std::uint64_t fileSize = 0;
+		std::unique_ptr<IoUring> ring;
+
+		std::unique_ptr<std::byte[]> readAhead;
+		std::size_t readAheadSize = 0;
+		std::vector<std::byte> buf;
+
+		std::size_t idx = 0;
+
+		Error error = Error::None;
+
+		explicit IoUringGltfFile(const std::filesystem::path& path) noexcept;
+
+		Error readAt(std::byte* ptr, std::uint64_t offset, std::size_t count);
+
+	public:
+		explicit IoUringGltfFile() noexcept;
+		IoUringGltfFile(const IoUringGltfFile& other) = delete;
+		IoUringGltfFile& operator=(const IoUringGltfFile& other) = delete;
+		IoUringGltfFile(IoUringGltfFile&& other) noexcept;
+		IoUringGltfFile& operator=(IoUringGltfFile&& other) noexcept;
+		~IoUringGltfFile() noexcept override;
+
+		static Expected<IoUringGltfFile> FromPath(const std::filesystem::path& path) noexcept {
+			IoUringGltfFile file(path);
+			if (file.error != fastgltf::Error::None) {
+				return file.error;
+			}
+			return file;
+		}
+
+		void read(void* ptr, std::size_t count) override;
+
+		[[nodiscard]] span<std::byte> read(std::size_t count, std::size_t padding) override;
+
+		void skip(std::size_t count) override;
+
 		void reset() override;
 
 		[[nodiscard]] std::size_t bytesRead() override;
 
 		[[nodiscard]] std::size_t totalSize() override;
+
+		[[nodiscard]] Error readError() const noexcept override;
 	};
+#endif
 
     #if defined(__ANDROID__)
 	FASTGLTF_EXPORT void setAndroidAssetManager(AAssetManager* assetManager) noexcept;
@@ -760,6 +938,134 @@ namespace fastgltf {
 	*/
 	FASTGLTF_EXPORT [[nodiscard]] Error validate(const Asset& asset);
 
+	/**
+	 * Decompresses a buffer view using EXT_meshopt_compression into a new buffer, which is appended
+	 * to the asset. The buffer view is then changed to point to the new buffer, and its
+	 * meshoptCompression is reset. Buffer views without compression are left untouched.
+	 * The compressed data has to be available as a sources::Array, sources::Vector, or sources::ByteView.
+	 */
+	FASTGLTF_EXPORT [[nodiscard]] Error decompressMeshoptBufferView(Asset& asset, std::size_t bufferViewIndex);
+
+	/**
+	 * Reorders the triangles of an indexed triangle list to improve the hit rate of the post-transform
+	 * vertex cache, using the Tipsify algorithm by Sander et al. The winding of every triangle is kept,
+	 * and trailing indices which do not form a full triangle are left untouched. All indices have to be
+	 * smaller than vertexCount.
+	 */
+	FASTGLTF_EXPORT void optimizeVertexCache(span<std::uint32_t> indices, std::size_t vertexCount, std::size_t cacheSize = 16);
+
+	/**
+	 * Computes the average cache miss ratio (ACMR) of an indexed triangle list, which is the average
+	 * amount of vertices that have to be transformed per triangle with a FIFO vertex cache of the given
+	 * size. It is 3 in the worst case, and approaches 0.5 for large, well optimized meshes.
+	 */
+	FASTGLTF_EXPORT [[nodiscard]] float computeVertexCacheMissRatio(span<const std::uint32_t> indices, std::size_t vertexCount, std::size_t cacheSize = 16);
+
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+	/**
+	 * A monotonic memory resource which allocates from a list of blocks, each twice as large as
+	 * the previous one, up to 4 MiB. Unlike std::pmr::monotonic_buffer_resource, the blocks can be kept when
+	 * the resource is reset, so that the memory can be reused for a later allocation pass.
+	 * The Parser uses this for the allocations of each Asset.
+	 */
+	FASTGLTF_EXPORT class ChunkMemoryResource : public std::pmr::memory_resource {
+		struct Block {
+			std::unique_ptr<std::byte[]> data;
+			std::size_t size;
+		};
+
+		std::vector<Block> blocks;
+		std::size_t blockIdx = 0;
+		std::size_t blockOffset = 0;
+
+		static constexpr std::size_t initialBlockSize = 4096;
+		static constexpr std::size_t maxBlockSize = 4 * 1024 * 1024;
+
+		// The size of the next block allocated to grow the resource. This grows geometrically from
+		// initialBlockSize, independently of blocks created by reserve(), and is capped at maxBlockSize.
+		std::size_t nextBlockSize = initialBlockSize;
+
+#if FASTGLTF_ENABLE_STATISTICS
+		std::uint64_t allocations = 0;
+		std::uint64_t allocatedSize = 0;
+#endif
+
+	public:
+		explicit ChunkMemoryResource() noexcept = default;
+		ChunkMemoryResource(const ChunkMemoryResource& other) = delete;
+		ChunkMemoryResource& operator=(const ChunkMemoryResource& other) = delete;
+		~ChunkMemoryResource() override = default;
+
+		/**
+		 * Ensures that the blocks can hold at least the given amount of bytes in total, so that
+		 * allocations up to that size do not need to allocate new blocks.
+		 */
+		void reserve(std::size_t bytes);
+
+		/**
+		 * Makes all blocks available for new allocations again, without freeing them. All memory
+		 * previously allocated from this resource must not be used after this.
+		 */
+		void reset() noexcept;
+
+		/** The total size of all blocks. */
+		[[nodiscard]] std::size_t capacity() const noexcept;
+
+#if FASTGLTF_ENABLE_STATISTICS
+		/** The number of allocations served by this resource since it was created. */
+		[[nodiscard]] std::uint64_t allocationCount() const noexcept {
+			return allocations;
+		}
+
+		/** The total size of all allocations served by this resource since it was created. */
+		[[nodiscard]] std::uint64_t allocatedBytes() const noexcept {
+			return allocatedSize;
+		}
+#endif
+
+	protected:
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+		void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+		[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+	};
+#endif
+
+#if FASTGLTF_ENABLE_STATISTICS
+	FASTGLTF_EXPORT struct CategoryStatistics {
+		/** The number of allocations made for this category. */
+		std::uint64_t allocationCount = 0;
+		/** The total size of all allocations made for this category, in bytes. */
+		std::uint64_t allocatedBytes = 0;
+		/** The number of bytes of JSON written for this category. This is only used by the Exporter. */
+		std::uint64_t writtenBytes = 0;
+		/** The time spent in the parse or write function of this category. */
+		std::chrono::nanoseconds duration {};
+	};
+
+	/**
+	 * Statistics collected during the last load or export, for each category. For the Parser, the
+	 * allocations include those served by the memory arena, the vectors in the Asset, and the data
+	 * owned by buffers and images.
+	 */
+	FASTGLTF_EXPORT struct Statistics {
+		/** The statistics of each category, indexed by the bit index of the category. */
+		std::array<CategoryStatistics, 14> categories = {};
+
+		/** The time spent parsing the JSON document into a DOM. */
+		std::chrono::nanoseconds jsonDuration {};
+		/** The time spent loading external files after all categories were parsed. */
+		std::chrono::nanoseconds externalFilesDuration {};
+
+		[[nodiscard]] CategoryStatistics& operator[](Category category) noexcept {
+			return categories[31 - clz(static_cast<std::uint32_t>(category))];
+		}
+
+		[[nodiscard]] const CategoryStatistics& operator[](Category category) const noexcept {
+			return categories[31 - clz(static_cast<std::uint32_t>(category))];
+		}
+	};
+#endif
+
     /**
      * Some internals the parser passes on to each glTF instance.
      */
@@ -768,6 +1074,7 @@ namespace fastgltf {
         BufferUnmapCallback* unmapCallback = nullptr;
         Base64DecodeCallback* decodeCallback = nullptr;
 		ExtrasParseCallback* extrasCallback = nullptr;
+		ParallelTaskCallback* parallelTaskCallback = nullptr;
 
         void* userPointer = nullptr;
         Extensions extensions = Extensions::None;
@@ -783,28 +1090,69 @@ namespace fastgltf {
         // The simdjson parser object. We want to share it between runs, so it does not need to
         // reallocate over and over again. We're hiding it here to not leak the simdjson header.
         std::unique_ptr<simdjson::dom::parser> jsonParser;
+		// The On-Demand parser used with Options::OnDemandParsing, which is only created once needed.
+		struct OnDemandParser;
+		std::unique_ptr<OnDemandParser> onDemandParser;
 
 		ParserInternalConfig config = {};
 		DataSource glbBuffer;
+		std::shared_ptr<const void> glbBufferStorage;
 #if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
-		std::shared_ptr<std::pmr::monotonic_buffer_resource> resourceAllocator;
+		std::shared_ptr<ChunkMemoryResource> resourceAllocator;
+
+		// The arenas of destroyed assets. The deleter of every arena this parser hands out returns it
+		// to this pool, from which the next load takes it, resets it, and reuses all of its blocks.
+		struct MemoryResourcePool;
+		std::shared_ptr<MemoryResourcePool> memoryResourcePool;
+		std::size_t memoryResourceSizeHint = 0;
+
+		[[nodiscard]] std::shared_ptr<ChunkMemoryResource> acquireMemoryResource(std::size_t sizeHint);
+		void releaseUnusedMemoryResources();
 #endif
 		std::filesystem::path directory;
 		Options options = Options::None;
 
+#if FASTGLTF_ENABLE_STATISTICS
+		Statistics statistics;
+#endif
+
+#if defined(FASTGLTF_HAS_MEMORY_MAPPED_FILE)
+		// The files mapped with Options::MapExternalFiles during the current load. This is shared
+		// with the tasks of a parallel load, so that every file only gets mapped once.
+		struct MappedFiles;
+		std::shared_ptr<MappedFiles> mappedFiles;
+
+		void resetMappedFiles();
+		void moveMappedFiles(Asset& asset);
+#endif
+
 		static auto getMimeTypeFromString(std::string_view mime) -> MimeType;
 		static void fillCategories(Category& inputCategories) noexcept;
 
 		template <typename T>
 		Error parseAttributes(simdjson::dom::object& object, T& attributes);
 
+		[[nodiscard]] Error parseJson(span<std::byte> json, std::size_t length, Category categories, simdjson::dom::object& root, Category& skippedCategories);
 		[[nodiscard]] auto decodeDataUri(URIView& uri) const noexcept -> Expected<DataSource>;
 		[[nodiscard]] auto loadFileFromUri(URIView& uri) const noexcept -> Expected<DataSource>;
+		// A buffer or image referencing a local file, which is loaded once all categories have been parsed.
+		struct ExternalFile {
+			DataSource* data;
+			MimeType mimeType;
+			Error error = Error::None;
+		};
+
+		[[nodiscard]] bool deferExternalFiles() const noexcept;
+		[[nodiscard]] Error loadExternalFiles(Asset& asset, Category categories) const;
+#if defined(FASTGLTF_HAS_IO_URING)
+		void readExternalFiles(span<ExternalFile> files) const;
+#endif
 #if defined(__ANDROID__)
 		[[nodiscard]] auto loadFileFromApk(const std::filesystem::path& filepath) const noexcept -> Expected<DataSource>;
 #endif
 
 		Error generateMeshIndices(Asset& asset) const;
+		Error optimizeMeshes(Asset& asset) const;
 
 		Error parseAccessors(simdjson::dom::array& array, Asset& asset);
 		Error parseAnimations(simdjson::dom::array& array, Asset& asset);
@@ -823,7 +1171,12 @@ namespace fastgltf {
 		Error parseScenes(simdjson::dom::array& array, Asset& asset);
 		Error parseSkins(simdjson::dom::array& array, Asset& asset);
 		Error parseTextures(simdjson::dom::array& array, Asset& asset);
-		Expected<Asset> parse(simdjson::dom::object root, Category categories);
+		Expected<Asset> parse(simdjson::dom::object root, Category categories, Category skippedCategories);
+
+		// A parser used by a single task of a parallel load to call one of the parse functions above.
+		// It only shares the configuration of its parent, and does not own any JSON parser.
+		struct TaskContext {};
+		Parser(const Parser& parent, TaskContext) noexcept;
 
     public:
         explicit Parser(Extensions extensionsToLoad = Extensions::None) noexcept;
@@ -889,7 +1242,37 @@ namespace fastgltf {
 
 		void setExtrasParseCallback(ExtrasParseCallback* extrasCallback) noexcept;
 
+		/**
+		 * Enables parsing the top-level glTF categories, like accessors, meshes, or nodes, in parallel.
+		 * Once the JSON document has been parsed, every category is handed to the callback as a separate
+		 * task, each of which allocates from its own memory arena. The resulting Asset is identical to
+		 * the one produced when no callback is set. Pass nullptr to parse all categories serially again.
+		 *
+		 * Large base64 encoded buffers and images are also decoded in parallel through this callback,
+		 * which is why it might be invoked from within one of its own tasks. External buffers and images
+		 * loaded through Options::LoadExternalBuffers and Options::LoadExternalImages are collected while
+		 * parsing, and are then all read concurrently, with one task per file.
+		 *
+		 * @note When this is set, the other callbacks might be invoked concurrently from multiple threads.
+		 */
+		void setParallelTaskCallback(ParallelTaskCallback* parallelTaskCallback) noexcept;
+
+		/**
+		 * Sets the amount of memory reserved up front in the arena used for the allocations of each
+		 * Asset, e.g. derived from the size of the JSON. Arenas are reused across loads once their asset
+		 * has been destroyed, so that repeated loads of similar files barely allocate at all.
+		 * This has no effect if FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL is set.
+		 */
+		void setMemoryResourceSizeHint(std::size_t bytes) noexcept;
+
         void setUserPointer(void* pointer) noexcept;
+
+#if FASTGLTF_ENABLE_STATISTICS
+		/**
+		 * Returns the statistics of the last load. This is only available with FASTGLTF_ENABLE_STATISTICS.
+		 */
+		[[nodiscard]] const Statistics& getStatistics() const noexcept;
+#endif
     };
 
     /**
@@ -932,6 +1315,10 @@ namespace fastgltf {
         std::vector<std::optional<std::filesystem::path>> bufferPaths;
         std::vector<std::optional<std::filesystem::path>> imagePaths;
 
+#if FASTGLTF_ENABLE_STATISTICS
+		Statistics statistics;
+#endif
+
         void writeAccessors(const Asset& asset, std::string& json);
         void writeAnimations(const Asset& asset, std::string& json);
         void writeBuffers(const Asset& asset, std::string& json);
@@ -971,6 +1358,14 @@ namespace fastgltf {
 
 		void setUserPointer(void* pointer) noexcept;
 
+#if FASTGLTF_ENABLE_STATISTICS
+		/**
+		 * Returns the statistics of the last export. This is only available with FASTGLTF_ENABLE_STATISTICS.
+		 * Allocations are not tracked for exports, as the JSON is written into a single string.
+		 */
+		[[nodiscard]] const Statistics& getStatistics() const noexcept;
+#endif
+
         /**
          * Generates a glTF JSON string from the given asset.
          */
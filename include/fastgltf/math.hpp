@@ -845,6 +845,21 @@ namespace fastgltf::math {
 	FASTGLTF_EXPORT using dmat3x3 = dmat<3, 3>;
 	FASTGLTF_EXPORT using dmat4x4 = dmat<4, 4>;
 
+	/**
+	 * Composes a transform matrix from the translation, rotation, and scale components. This gives
+	 * the same result as translating, rotating, and then scaling an identity matrix, but directly
+	 * writes the scaled rotation matrix instead of multiplying matrices.
+	 */
+	FASTGLTF_EXPORT template <typename T>
+	[[nodiscard]] auto composeTransformMatrix(const vec<T, 3>& translation, const quat<T>& rotation, const vec<T, 3>& scale) noexcept {
+		const auto r = asMatrix(rotation);
+		return mat<T, 4, 4>(
+			vec<T, 4>(r.col(0).x() * scale.x(), r.col(0).y() * scale.x(), r.col(0).z() * scale.x(), T(0)),
+			vec<T, 4>(r.col(1).x() * scale.y(), r.col(1).y() * scale.y(), r.col(1).z() * scale.y(), T(0)),
+			vec<T, 4>(r.col(2).x() * scale.z(), r.col(2).y() * scale.z(), r.col(2).z() * scale.z(), T(0)),
+			vec<T, 4>(translation.x(), translation.y(), translation.z(), T(1)));
+	}
+
 	/**
 	 * Decomposes a transform matrix into the translation, rotation, and scale components. This
 	 * function does not support skew, shear, or perspective. This currently uses a quick algorithm
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2022 - 2024 spnda
+ * This file is part of fastgltf <https://github.com/spnda/fastgltf>.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#if !defined(FASTGLTF_USE_STD_MODULE) || !FASTGLTF_USE_STD_MODULE
+#include <cstddef>
+#include <cstdint>
+#endif
+
+#include <fastgltf/types.hpp>
+
+#ifdef _MSC_VER
+#pragma warning(push) // attribute 'x' is not recognized
+#pragma warning(disable : 5030)
+#endif
+
+/**
+ * Decoders for the bitstreams of EXT_meshopt_compression, as specified in
+ * https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Vendor/EXT_meshopt_compression/README.md.
+ * All decoders return false if the data is malformed, in which case the contents of the destination are unspecified.
+ */
+namespace fastgltf::meshopt {
+	/**
+	 * Decodes count elements of byteStride bytes each, compressed with the ATTRIBUTES mode, into destination.
+	 * byteStride has to be a multiple of 4 and at most 256.
+	 */
+	FASTGLTF_EXPORT [[nodiscard]] bool decodeVertexBuffer(std::byte* destination, std::size_t count, std::size_t byteStride, span<const std::byte> source);
+
+	/**
+	 * Decodes count indices of indexSize bytes each, compressed with the TRIANGLES mode, into destination.
+	 * count has to be a multiple of 3, and indexSize either 2 or 4.
+	 */
+	FASTGLTF_EXPORT [[nodiscard]] bool decodeIndexBuffer(std::byte* destination, std::size_t count, std::size_t indexSize, span<const std::byte> source);
+
+	/**
+	 * Decodes count indices of indexSize bytes each, compressed with the INDICES mode, into destination.
+	 * indexSize has to be either 2 or 4.
+	 */
+	FASTGLTF_EXPORT [[nodiscard]] bool decodeIndexSequence(std::byte* destination, std::size_t count, std::size_t indexSize, span<const std::byte> source);
+
+	/**
+	 * Applies the given filter in place to count elements of byteStride bytes each, which have previously
+	 * been decoded with decodeVertexBuffer. Returns false if the filter does not support the byteStride.
+	 */
+	FASTGLTF_EXPORT [[nodiscard]] bool decodeFilter(MeshoptCompressionFilter filter, std::byte* data, std::size_t count, std::size_t byteStride);
+
+	/**
+	 * Decodes the compressed data of a buffer view into destination, which has to be at least
+	 * compression.count * compression.byteStride bytes large. source has to point to the
+	 * compression.byteLength bytes of compressed data.
+	 */
+	FASTGLTF_EXPORT [[nodiscard]] bool decode(const CompressedBufferView& compression, span<const std::byte> source, std::byte* destination);
+
+	/**
+	 * Checks the decoded size of a compressed buffer view before anything is allocated for it. The byteStride
+	 * has to be a non-zero multiple of 4 of at most 256 for the ATTRIBUTES mode, and 2 or 4 for the index
+	 * modes. count * byteStride must not overflow, and has to equal the byteLength of the buffer view.
+	 */
+	FASTGLTF_EXPORT [[nodiscard]] bool isValidDecodedSize(const CompressedBufferView& compression, std::size_t byteLength) noexcept;
+
+#if defined(FASTGLTF_IS_X86)
+	[[nodiscard]] bool sse4_decode_vertex_buffer(std::byte* destination, std::size_t count, std::size_t byteStride, span<const std::byte> source);
+	void sse4_decode_filter(MeshoptCompressionFilter filter, std::byte* data, std::size_t count, std::size_t byteStride);
+#endif
+	[[nodiscard]] bool fallback_decode_vertex_buffer(std::byte* destination, std::size_t count, std::size_t byteStride, span<const std::byte> source);
+	void fallback_decode_filter(MeshoptCompressionFilter filter, std::byte* data, std::size_t count, std::size_t byteStride);
+} // namespace fastgltf::meshopt
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
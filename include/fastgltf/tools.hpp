@@ -29,6 +29,7 @@
 #if !defined(FASTGLTF_USE_STD_MODULE) || !FASTGLTF_USE_STD_MODULE
 #include <cstring>
 #include <iterator>
+#include <memory>
 #endif
 
 #include <fastgltf/types.hpp>
@@ -265,7 +266,7 @@ inline double deserializeComponent<double>(const std::byte* bytes, std::size_t i
 #endif
 
 template <typename DestType, typename SourceType>
-constexpr DestType convertComponent(const SourceType& source, bool normalized) {
+FASTGLTF_FORCEINLINE constexpr DestType convertComponent(const SourceType& source, bool normalized) {
 	if (normalized) {
 		if constexpr (std::is_floating_point_v<SourceType> && std::is_integral_v<DestType>) {
 			// float -> int conversion
@@ -290,7 +291,7 @@ constexpr DestType convertComponent(const SourceType& source, bool normalized) {
 }
 
 template <typename DestType, typename SourceType>
-constexpr DestType convertComponent(const std::byte* bytes, std::size_t index, AccessorType accessorType, bool normalized) {
+FASTGLTF_FORCEINLINE constexpr DestType convertComponent(const std::byte* bytes, std::size_t index, AccessorType accessorType, bool normalized) {
 	if (isMatrix(accessorType)) {
 		const auto rowCount = getElementRowCount(accessorType);
 		const auto componentSize = sizeof(SourceType);
@@ -345,7 +346,7 @@ template <typename ElementType, typename SourceType, std::size_t... I>
 #if FASTGLTF_HAS_CONCEPTS
 requires Element<ElementType>
 #endif
-constexpr ElementType convertAccessorElement(const std::byte* bytes, bool normalized, std::index_sequence<I...>) {
+FASTGLTF_FORCEINLINE constexpr ElementType convertAccessorElement(const std::byte* bytes, bool normalized, std::index_sequence<I...>) {
 	using Traits = ElementTraits<ElementType>;
 	static_assert(std::is_arithmetic_v<typename Traits::component_type>, "Accessor traits must provide a valid component type");
 
@@ -387,6 +388,88 @@ ElementType getAccessorElementAt(ComponentType componentType, const std::byte* b
 	}
 }
 
+template <typename T>
+struct ComponentTag {
+	using type = T;
+};
+
+/**
+ * Invokes the functor with a ComponentTag of the C++ type matching the given component type, so that
+ * the functor can instantiate its loops for the concrete source type. Returns false for invalid types.
+ */
+template <typename Functor>
+bool dispatchComponentType(ComponentType componentType, Functor&& func) {
+	switch (componentType) {
+		case ComponentType::Byte:
+			func(ComponentTag<std::int8_t>{});
+			return true;
+		case ComponentType::UnsignedByte:
+			func(ComponentTag<std::uint8_t>{});
+			return true;
+		case ComponentType::Short:
+			func(ComponentTag<std::int16_t>{});
+			return true;
+		case ComponentType::UnsignedShort:
+			func(ComponentTag<std::uint16_t>{});
+			return true;
+		case ComponentType::Int:
+			func(ComponentTag<std::int32_t>{});
+			return true;
+		case ComponentType::UnsignedInt:
+			func(ComponentTag<std::uint32_t>{});
+			return true;
+		case ComponentType::Float:
+			func(ComponentTag<float>{});
+			return true;
+		case ComponentType::Double:
+			func(ComponentTag<double>{});
+			return true;
+		case ComponentType::Invalid:
+		default:
+			return false;
+	}
+}
+
+/**
+ * Reads count consecutive elements with the source type and normalization known at compile time,
+ * calling the functor with each element and its index. Tightly packed data uses a constant stride.
+ */
+template <typename ElementType, typename SourceType, bool Normalized, typename Functor>
+void readAccessorElements(const std::byte* bytes, std::size_t stride, std::size_t count, Functor& func) {
+	using Traits = ElementTraits<ElementType>;
+	using Seq = std::make_index_sequence<getNumComponents(Traits::type)>;
+	constexpr auto elemSize = getElementByteSize(Traits::type, ComponentTypeConverter<SourceType>::type);
+
+	if (stride == elemSize) {
+		for (std::size_t i = 0; i < count; ++i) {
+			func(convertAccessorElement<ElementType, SourceType>(bytes + i * elemSize, Normalized, Seq{}), i);
+		}
+	} else {
+		for (std::size_t i = 0; i < count; ++i) {
+			func(convertAccessorElement<ElementType, SourceType>(bytes + i * stride, Normalized, Seq{}), i);
+		}
+	}
+}
+
+/**
+ * Reads count consecutive elements, dispatching once over the component type and normalization instead
+ * of for every element like getAccessorElementAt. Returns false if the component type is invalid.
+ */
+template <typename ElementType, typename Functor>
+bool readAccessorElements(ComponentType componentType, bool normalized, const std::byte* bytes, std::size_t stride,
+		std::size_t count, Functor&& func) {
+	return dispatchComponentType(componentType, [&](auto tag) {
+		using SourceType = typename decltype(tag)::type;
+		if constexpr (std::is_integral_v<SourceType>) {
+			if (normalized) {
+				readAccessorElements<ElementType, SourceType, true>(bytes, stride, count, func);
+				return;
+			}
+		}
+		readAccessorElements<ElementType, SourceType, false>(bytes, stride, count, func);
+	});
+}
+
 // Performs a binary search for the index into the sparse index list whose value matches the desired index
 template <typename ElementType>
 bool findSparseIndex(const std::byte* indices, std::size_t indexCount, std::size_t desiredIndex,
@@ -435,8 +518,121 @@ inline bool findSparseIndex(ComponentType componentType, const std::byte* bytes,
 	return false;
 }
 
+// Batch conversion kernels used by copyFromAccessor and copyComponentsFromAccessor. These operate on
+// tightly packed components and produce the exact same results as convertComponent.
+#if defined(FASTGLTF_IS_X86)
+void sse4_convert_to_float(const std::byte* src, float* dst, std::size_t count, ComponentType componentType, bool normalized);
+void avx2_convert_to_float(const std::byte* src, float* dst, std::size_t count, ComponentType componentType, bool normalized);
+void sse4_widen_indices(const std::byte* src, std::uint32_t* dst, std::size_t count, ComponentType componentType);
+void avx2_widen_indices(const std::byte* src, std::uint32_t* dst, std::size_t count, ComponentType componentType);
+void avx2_convert_to_half(const float* src, std::uint16_t* dst, std::size_t count);
+#elif defined(FASTGLTF_IS_A64)
+void neon_convert_to_float(const std::byte* src, float* dst, std::size_t count, ComponentType componentType, bool normalized);
+void neon_widen_indices(const std::byte* src, std::uint32_t* dst, std::size_t count, ComponentType componentType);
+void neon_convert_to_half(const float* src, std::uint16_t* dst, std::size_t count);
+#endif
+void fallback_convert_to_float(const std::byte* src, float* dst, std::size_t count, ComponentType componentType, bool normalized);
+void fallback_widen_indices(const std::byte* src, std::uint32_t* dst, std::size_t count, ComponentType componentType);
+void fallback_convert_to_half(const float* src, std::uint16_t* dst, std::size_t count);
+
+// Multiply-add kernels used by blendMorphTargets, which compute dst[i] += weight * src[i].
+// None of them use fused multiply-add, so that every kernel rounds the product and the sum the same way.
+#if defined(FASTGLTF_IS_X86)
+void sse4_multiply_add(const float* src, float* dst, std::size_t count, float weight);
+void avx2_multiply_add(const float* src, float* dst, std::size_t count, float weight);
+#elif defined(FASTGLTF_IS_A64)
+void neon_multiply_add(const float* src, float* dst, std::size_t count, float weight);
+#endif
+void fallback_multiply_add(const float* src, float* dst, std::size_t count, float weight);
+
+// World transform kernels used by computeWorldTransforms. For every i, these compute the world matrix
+// of the node order[i] from the world matrix of the node parents[i], or from initial for root nodes.
+#if defined(FASTGLTF_IS_X86)
+void sse4_compute_world_transforms(const Node* nodes, const std::size_t* order, const std::size_t* parents, std::size_t count,
+		const math::fmat4x4& initial, math::fmat4x4* worldMatrices);
+#elif defined(FASTGLTF_IS_A64)
+void neon_compute_world_transforms(const Node* nodes, const std::size_t* order, const std::size_t* parents, std::size_t count,
+		const math::fmat4x4& initial, math::fmat4x4* worldMatrices);
+#endif
+void fallback_compute_world_transforms(const Node* nodes, const std::size_t* order, const std::size_t* parents, std::size_t count,
+		const math::fmat4x4& initial, math::fmat4x4* worldMatrices);
+
+// The same as the kernels above, but using precomputed local matrices indexed by node, for TransformCache.
+#if defined(FASTGLTF_IS_X86)
+void sse4_update_world_transforms(const math::fmat4x4* localMatrices, const std::size_t* order, const std::size_t* parents, std::size_t count,
+		const math::fmat4x4& initial, math::fmat4x4* worldMatrices);
+#elif defined(FASTGLTF_IS_A64)
+void neon_update_world_transforms(const math::fmat4x4* localMatrices, const std::size_t* order, const std::size_t* parents, std::size_t count,
+		const math::fmat4x4& initial, math::fmat4x4* worldMatrices);
+#endif
+void fallback_update_world_transforms(const math::fmat4x4* localMatrices, const std::size_t* order, const std::size_t* parents, std::size_t count,
+		const math::fmat4x4& initial, math::fmat4x4* worldMatrices);
+
+// Joint matrix kernels used by SkinningCache. For every i, these compute the joint matrix
+// worldMatrices[joints[i]] * inverseBindMatrices[i].
+#if defined(FASTGLTF_IS_X86)
+void sse4_compute_joint_matrices(const math::fmat4x4* worldMatrices, const std::size_t* joints,
+		const math::fmat4x4* inverseBindMatrices, std::size_t count, math::fmat4x4* jointMatrices);
+#elif defined(FASTGLTF_IS_A64)
+void neon_compute_joint_matrices(const math::fmat4x4* worldMatrices, const std::size_t* joints,
+		const math::fmat4x4* inverseBindMatrices, std::size_t count, math::fmat4x4* jointMatrices);
+#endif
+void fallback_compute_joint_matrices(const math::fmat4x4* worldMatrices, const std::size_t* joints,
+		const math::fmat4x4* inverseBindMatrices, std::size_t count, math::fmat4x4* jointMatrices);
+
+/** Returns true if the batch conversion kernels can convert the given component type. */
+constexpr bool isBatchConvertible(ComponentType componentType) noexcept {
+	return componentType == ComponentType::Byte || componentType == ComponentType::UnsignedByte
+		|| componentType == ComponentType::Short || componentType == ComponentType::UnsignedShort;
+}
+
+/**
+ * Converts count elements of componentCount 8-bit or 16-bit integer components each to floats.
+ * Strided source or destination data is gathered into small packed blocks first, so that interleaved
+ * vertex data can still use the fastest kernel available on this system.
+ */
+void convertComponentsToFloat(const std::byte* src, std::size_t srcStride, std::byte* dst, std::size_t dstStride,
+		std::size_t componentCount, std::size_t count, ComponentType componentType, bool normalized);
+
+/**
+ * Zero-extends count elements of componentCount unsigned 8-bit or 16-bit components each to 32-bit integers.
+ */
+void widenComponents(const std::byte* src, std::size_t srcStride, std::byte* dst, std::size_t dstStride,
+		std::size_t componentCount, std::size_t count, ComponentType componentType);
+
+/**
+ * Copies count elements of elemSize bytes each between two possibly strided buffers.
+ */
+inline void copyStridedElements(const std::byte* src, std::size_t srcStride, std::byte* dst, std::size_t dstStride,
+		std::size_t elemSize, std::size_t count) {
+	// Fixed-size copies are lowered into plain loads and stores, instead of a memcpy call per element.
+	auto copy = [&](auto size) {
+		for (std::size_t i = 0; i < count; ++i) {
+			std::memcpy(dst + dstStride * i, src + srcStride * i, decltype(size)::value);
+		}
+	};
+	switch (elemSize) {
+		case 2: return copy(std::integral_constant<std::size_t, 2>());
+		case 4: return copy(std::integral_constant<std::size_t, 4>());
+		case 6: return copy(std::integral_constant<std::size_t, 6>());
+		case 8: return copy(std::integral_constant<std::size_t, 8>());
+		case 12: return copy(std::integral_constant<std::size_t, 12>());
+		case 16: return copy(std::integral_constant<std::size_t, 16>());
+		default:
+			for (std::size_t i = 0; i < count; ++i) {
+				std::memcpy(dst + dstStride * i, src + srcStride * i, elemSize);
+			}
+	}
+}
+
 } // namespace internal
 
+/**
+ * Converts the given floats to IEEE 754 half-precision floats, rounding to nearest even.
+ * This uses F16C or the Neon conversion instructions when available.
+ */
+FASTGLTF_EXPORT void convertToHalf(const float* src, std::uint16_t* dst, std::size_t count);
+
 FASTGLTF_EXPORT struct DefaultBufferDataAdapter {
 	auto operator()(const Asset& asset, std::size_t bufferViewIdx) const {
 		auto& bufferView = asset.bufferViews[bufferViewIdx];
@@ -465,6 +661,78 @@ FASTGLTF_EXPORT struct DefaultBufferDataAdapter {
 	}
 };
 
+/**
+ * A BufferDataAdapter which, in addition to the sources the DefaultBufferDataAdapter supports, can
+ * serve buffer views whose data first needs to be loaded or decoded. Buffer views compressed with
+ * EXT_meshopt_compression are decompressed, the ranges of buffer views from external files which
+ * have not been loaded are read from disk, and base64 data URIs are decoded. This only happens once
+ * a buffer view is first used, and the results are kept in an LRU cache which evicts the least
+ * recently used data once the memory budget is exceeded. Buffer views which are already in memory
+ * are returned directly, without going through the cache.
+ *
+ * Copies of an adapter share the same cache, and the adapter can be used from multiple threads at
+ * once, e.g. with parallelCopyFromAccessor. The returned Bytes share ownership of the cached data,
+ * which therefore stays valid for as long as the Bytes, or any subspan of them, are alive, even if the
+ * cache evicts it in the meantime. Buffer views larger than the memory budget are never cached, and
+ * are decoded again every time they are requested.
+ *
+ * If the data of a buffer view cannot be obtained, this asserts and returns an empty span.
+ */
+FASTGLTF_EXPORT class CachingBufferDataAdapter {
+	struct Cache;
+	std::shared_ptr<Cache> cache;
+
+public:
+	static constexpr std::size_t defaultMemoryBudget = 256 * 1024 * 1024;
+
+	/**
+	 * The data of a buffer view, which keeps the decoded data it references alive. Converting this to
+	 * a plain span drops that ownership.
+	 */
+	class Bytes : public span<const std::byte> {
+		std::shared_ptr<const StaticVector<std::byte>> owner;
+
+	public:
+		Bytes() noexcept = default;
+		Bytes(span<const std::byte> data, std::shared_ptr<const StaticVector<std::byte>> owner) noexcept
+			: span<const std::byte>(data), owner(std::move(owner)) {}
+
+		[[nodiscard]] Bytes first(std::size_t count) const {
+			return Bytes(span<const std::byte>::first(count), owner);
+		}
+
+		[[nodiscard]] Bytes last(std::size_t count) const {
+			return Bytes(span<const std::byte>::last(count), owner);
+		}
+
+		[[nodiscard]] Bytes subspan(std::size_t offset, std::size_t count = dynamic_extent) const {
+			return Bytes(span<const std::byte>::subspan(offset, count), owner);
+		}
+	};
+
+	/**
+	 * @param directory The directory relative to which URIs of external buffers are resolved.
+	 * @param memoryBudget The maximum amount of bytes the cache should hold.
+	 * @param glbPath The path of the GLB file, which is needed to read the GLB buffer deferred with Options::DeferGLBBuffer.
+	 */
+	explicit CachingBufferDataAdapter(std::filesystem::path directory, std::size_t memoryBudget = defaultMemoryBudget,
+			std::filesystem::path glbPath = {});
+
+	Bytes operator()(const Asset& asset, std::size_t bufferViewIdx) const;
+
+	/** Returns the amount of bytes currently held by the cache. */
+	[[nodiscard]] std::size_t memoryUsage() const;
+
+	/** Drops all cached data. Bytes that were previously returned stay valid. */
+	void clear();
+};
+
+namespace internal {
+/** The type returned by a BufferDataAdapter, which has to be kept alive for as long as its data is used. */
+template <typename BufferDataAdapter>
+using BufferDataAdapterResult = std::decay_t<std::invoke_result_t<const BufferDataAdapter&, const Asset&, std::size_t>>;
+} // namespace internal
+
 template <typename ElementType, typename BufferDataAdapter>
 class IterableAccessor;
 
@@ -560,14 +828,14 @@ class IterableAccessor {
 	const Asset& asset;
 	const Accessor& accessor;
 
-	span<const std::byte> bufferBytes;
+	internal::BufferDataAdapterResult<BufferDataAdapter> bufferBytes;
 	std::size_t stride;
 	fastgltf::ComponentType componentType;
 
 	// Data needed for sparse accessors
 	fastgltf::ComponentType indexComponentType;
-	span<const std::byte> indicesBytes;
-	span<const std::byte> valuesBytes;
+	internal::BufferDataAdapterResult<BufferDataAdapter> indicesBytes;
+	internal::BufferDataAdapterResult<BufferDataAdapter> valuesBytes;
 	std::size_t indexStride;
 	std::size_t valueStride;
 	std::size_t sparseCount;
@@ -613,6 +881,34 @@ public:
 static_assert(std::ranges::input_range<IterableAccessor<math::fvec4>>, "IterableAccessor needs to satisfy input_range");
 #endif
 
+namespace internal {
+/**
+ * Reads the element at the given index from the accessor's buffer view, ignoring any sparse values.
+ */
+template <typename ElementType, typename BufferDataAdapter>
+ElementType getDenseAccessorElement(const Asset& asset, const Accessor& accessor, std::size_t index,
+		const BufferDataAdapter& adapter) {
+	// 5.1.1. accessor.bufferView
+	// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
+	// property or extensions MAY override zeros with actual values.
+	if (!accessor.bufferViewIndex) {
+		if constexpr (std::is_aggregate_v<ElementType>) {
+			return ElementType{};
+		} else {
+			return ElementType();
+		}
+	}
+
+	const auto& view = asset.bufferViews[*accessor.bufferViewIndex];
+	auto stride = view.byteStride.value_or(getElementByteSize(accessor.type, accessor.componentType));
+
+	auto bytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
+
+	return getAccessorElementAt<ElementType>(
+			accessor.componentType, &bytes[index * stride], accessor.normalized);
+}
+} // namespace internal
+
 FASTGLTF_EXPORT template <typename ElementType, typename BufferDataAdapter = DefaultBufferDataAdapter>
 #if FASTGLTF_HAS_CONCEPTS
 requires Element<ElementType>
@@ -644,24 +940,111 @@ ElementType getAccessorElement(const Asset& asset, const Accessor& accessor, siz
 		}
 	}
 
-	// 5.1.1. accessor.bufferView
-	// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
-	// property or extensions MAY override zeros with actual values.
-	if (!accessor.bufferViewIndex) {
-		if constexpr (std::is_aggregate_v<ElementType>) {
-			return ElementType{};
-		} else {
-			return ElementType();
+	return internal::getDenseAccessorElement<ElementType>(asset, accessor, index, adapter);
+}
+
+/**
+ * Lookup structure for constant time random access into sparse accessors, which otherwise requires a
+ * binary search over the sparse indices for every element. It stores a bitmap with one bit per element
+ * of the accessor, together with the number of sparse values before every 64 elements, which amounts
+ * to 1.5 bits per element regardless of how many sparse values there are.
+ * The lookup only has to be created once per accessor, and is best kept alongside the asset.
+ */
+FASTGLTF_EXPORT class SparseAccessorLookup {
+	std::vector<std::uint64_t> bits;
+	std::vector<std::uint32_t> ranks;
+
+public:
+	SparseAccessorLookup() = default;
+
+	/**
+	 * Builds the lookup for the given accessor. If the accessor is not sparse, or its sparse indices are
+	 * not strictly increasing as the specification requires, the lookup is left empty.
+	 */
+	template <typename BufferDataAdapter = DefaultBufferDataAdapter>
+	explicit SparseAccessorLookup(const Asset& asset, const Accessor& accessor, const BufferDataAdapter& adapter = {}) {
+		if (!accessor.sparse || accessor.sparse->count == 0)
+			return;
+
+		auto indicesBytes = adapter(asset, accessor.sparse->indicesBufferView).subspan(accessor.sparse->indicesByteOffset);
+		auto indexStride = getElementByteSize(AccessorType::Scalar, accessor.sparse->indexComponentType);
+
+		bits.resize((accessor.count + 63) / 64);
+		std::size_t previous = 0;
+		for (std::size_t i = 0; i < accessor.sparse->count; ++i) {
+			auto index = internal::getAccessorElementAt<std::uint32_t>(accessor.sparse->indexComponentType,
+				&indicesBytes[indexStride * i]);
+			if (index >= accessor.count || (i != 0 && index <= previous)) {
+				bits = {};
+				return;
+			}
+			bits[index / 64] |= std::uint64_t(1) << (index % 64);
+			previous = index;
+		}
+
+		ranks.resize(bits.size());
+		std::uint32_t rank = 0;
+		for (std::size_t i = 0; i < bits.size(); ++i) {
+			ranks[i] = rank;
+			rank += popcount(bits[i]);
 		}
 	}
 
-	const auto& view = asset.bufferViews[*accessor.bufferViewIndex];
-    auto stride = view.byteStride.value_or(getElementByteSize(accessor.type, accessor.componentType));
+	/** Returns false if the lookup was never built, in which case find always returns false. */
+	[[nodiscard]] bool valid() const noexcept {
+		return !bits.empty();
+	}
 
-	auto bytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
+	/**
+	 * Returns true if the element at the given index is replaced by a sparse value, and writes the
+	 * index of that value within the sparse values to sparseIndex.
+	 */
+	[[nodiscard]] bool find(std::size_t index, std::size_t& sparseIndex) const noexcept {
+		const auto word = index / 64;
+		if (word >= bits.size())
+			return false;
 
-	return internal::getAccessorElementAt<ElementType>(
-            accessor.componentType, &bytes[index * stride], accessor.normalized);
+		const auto bit = std::uint64_t(1) << (index % 64);
+		if ((bits[word] & bit) == 0)
+			return false;
+
+		sparseIndex = ranks[word] + popcount(bits[word] & (bit - 1));
+		return true;
+	}
+
+	/** Returns the number of bytes allocated by this lookup. */
+	[[nodiscard]] std::size_t memoryUsage() const noexcept {
+		return bits.size() * sizeof(std::uint64_t) + ranks.size() * sizeof(std::uint32_t);
+	}
+};
+
+/**
+ * Same as getAccessorElement, but uses the given lookup to find sparse values in constant time,
+ * instead of searching the sparse indices. Falls back to the search if the lookup is not valid.
+ */
+FASTGLTF_EXPORT template <typename ElementType, typename BufferDataAdapter = DefaultBufferDataAdapter>
+#if FASTGLTF_HAS_CONCEPTS
+requires Element<ElementType>
+#endif
+ElementType getAccessorElement(const Asset& asset, const Accessor& accessor, size_t index,
+		const SparseAccessorLookup& lookup, const BufferDataAdapter& adapter = {}) {
+	if (!accessor.sparse || !lookup.valid())
+		return getAccessorElement<ElementType>(asset, accessor, index, adapter);
+
+	assert(accessor.type == ElementTraits<ElementType>::type && "The destination type needs to have the same AccessorType as the accessor.");
+
+	std::size_t sparseIndex{};
+	if (lookup.find(index, sparseIndex)) {
+		auto valuesBytes = adapter(asset, accessor.sparse->valuesBufferView).subspan(accessor.sparse->valuesByteOffset);
+		// "The index of the bufferView with sparse values. The referenced buffer view MUST NOT
+		// have its target or byteStride properties defined."
+		auto valueStride = getElementByteSize(accessor.type, accessor.componentType);
+		return internal::getAccessorElementAt<ElementType>(accessor.componentType,
+				&valuesBytes[valueStride * sparseIndex],
+				accessor.normalized);
+	}
+
+	return internal::getDenseAccessorElement<ElementType>(asset, accessor, index, adapter);
 }
 
 FASTGLTF_EXPORT template<typename ElementType, typename BufferDataAdapter = DefaultBufferDataAdapter>
@@ -672,20 +1055,37 @@ IterableAccessor<ElementType, BufferDataAdapter> iterateAccessor(const Asset& as
 	return IterableAccessor<ElementType, BufferDataAdapter>(asset, accessor, adapter);
 }
 
-FASTGLTF_EXPORT template <typename ElementType, typename Functor, typename BufferDataAdapter = DefaultBufferDataAdapter>
-#if FASTGLTF_HAS_CONCEPTS
-requires Element<ElementType> && std::is_invocable_v<Functor, ElementType>
-#endif
-void iterateAccessor(const Asset& asset, const Accessor& accessor, Functor&& func,
-		const BufferDataAdapter& adapter = {}) {
-	using Traits = ElementTraits<ElementType>;
-	static_assert(Traits::type != AccessorType::Invalid, "Accessor traits must provide a valid accessor type");
-	static_assert(Traits::enum_component_type != ComponentType::Invalid, "Accessor traits must provide a valid component type");
-	static_assert(std::is_default_constructible_v<ElementType>, "Element type must be default constructible");
-	static_assert(std::is_constructible_v<ElementType>, "Element type must be constructible");
-	static_assert(std::is_move_assignable_v<ElementType>, "Element type must be move-assignable");
+namespace internal {
+/**
+ * Invokes func with every element in [first, last) and its index, including the sparse values.
+ */
+template <typename ElementType, typename Functor, typename BufferDataAdapter>
+void iterateAccessorRange(const Asset& asset, const Accessor& accessor, std::size_t first, std::size_t last,
+		Functor& func, const BufferDataAdapter& adapter) {
+	BufferDataAdapterResult<BufferDataAdapter> srcBytes;
+	std::size_t srcStride = 0;
 
-	assert(accessor.type == Traits::type && "The destination type needs to have the same AccessorType as the accessor.");
+	// 5.1.1. accessor.bufferView
+	// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
+	// property or extensions MAY override zeros with actual values.
+	if (accessor.bufferViewIndex) {
+		auto& view = asset.bufferViews[*accessor.bufferViewIndex];
+		srcBytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
+		srcStride = view.byteStride.value_or(getElementByteSize(accessor.type, accessor.componentType));
+	}
+
+	// Reads a range of elements from the buffer view, with the component type only being dispatched once per range.
+	auto iterateRange = [&](std::size_t start, std::size_t count) {
+		auto invoke = [&](ElementType element, std::size_t i) {
+			std::invoke(func, std::move(element), start + i);
+		};
+		if (!accessor.bufferViewIndex || !readAccessorElements<ElementType>(accessor.componentType,
+				accessor.normalized, srcBytes.data() + srcStride * start, srcStride, count, invoke)) {
+			for (std::size_t i = 0; i < count; ++i) {
+				std::invoke(func, ElementType {}, start + i);
+			}
+		}
+	};
 
 	if (accessor.sparse && accessor.sparse->count > 0) {
 		auto indicesBytes = adapter(asset, accessor.sparse->indicesBufferView).subspan(accessor.sparse->indicesByteOffset);
@@ -696,89 +1096,41 @@ void iterateAccessor(const Asset& asset, const Accessor& accessor, Functor&& fun
 		// have its target or byteStride properties defined."
 		auto valueStride = getElementByteSize(accessor.type, accessor.componentType);
 
-		span<const std::byte> srcBytes;
-		std::size_t srcStride = 0;
-
-		// 5.1.1. accessor.bufferView
-		// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
-		// property or extensions MAY override zeros with actual values.
-		if (accessor.bufferViewIndex) {
-			auto& view = asset.bufferViews[*accessor.bufferViewIndex];
-			srcBytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
-            srcStride = view.byteStride.value_or(getElementByteSize(accessor.type, accessor.componentType));
-        }
-
-		auto nextSparseIndex = internal::getAccessorElementAt<std::uint32_t>(
-				accessor.sparse->indexComponentType, indicesBytes.data());
+		// The sparse indices are strictly increasing, so we read the dense ranges between them in one go.
 		std::size_t sparseIndexCount = 0;
-
-		for (std::size_t i = 0; i < accessor.count; ++i) {
-			if (i == nextSparseIndex) {
-				auto element = internal::getAccessorElementAt<ElementType>(accessor.componentType,
-						&valuesBytes[valueStride * sparseIndexCount],
-						accessor.normalized);
-
-				std::invoke(func, element);
-
-				++sparseIndexCount;
-
-				if (sparseIndexCount < accessor.sparse->count) {
-					nextSparseIndex = internal::getAccessorElementAt<std::uint32_t>(
-							accessor.sparse->indexComponentType, &indicesBytes[indexStride * sparseIndexCount]);
-				}
-			} else if (accessor.bufferViewIndex) {
-				auto element = internal::getAccessorElementAt<ElementType>(accessor.componentType,
-						&srcBytes[srcStride * i],
-						accessor.normalized);
-
-				std::invoke(func, element);
-			} else {
-				std::invoke(func, ElementType {});
-			}
+		if (first != 0) {
+			findSparseIndex(accessor.sparse->indexComponentType, indicesBytes.data(), accessor.sparse->count,
+				first, sparseIndexCount);
 		}
 
+		std::size_t position = first;
+		for (; sparseIndexCount < accessor.sparse->count; ++sparseIndexCount) {
+			auto sparseIndex = getAccessorElementAt<std::uint32_t>(
+					accessor.sparse->indexComponentType, &indicesBytes[indexStride * sparseIndexCount]);
+			if (sparseIndex < position || sparseIndex >= accessor.count)
+				continue;
+			if (sparseIndex >= last)
+				break;
+
+			iterateRange(position, sparseIndex - position);
+			std::invoke(func, getAccessorElementAt<ElementType>(accessor.componentType,
+					&valuesBytes[valueStride * sparseIndexCount],
+					accessor.normalized), static_cast<std::size_t>(sparseIndex));
+			position = sparseIndex + 1;
+		}
+		iterateRange(position, last - position);
 		return;
 	}
 
-	// 5.1.1. accessor.bufferView
-	// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
-	// property or extensions MAY override zeros with actual values.
-	if (!accessor.bufferViewIndex) {
-		for (std::size_t i = 0; i < accessor.count; ++i) {
-			std::invoke(func, ElementType {});
-		}
-	} else {
-		auto& view = asset.bufferViews[*accessor.bufferViewIndex];
-        auto stride = view.byteStride.value_or(getElementByteSize(accessor.type, accessor.componentType));
-
-		auto bytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
-
-		for (std::size_t i = 0; i < accessor.count; ++i) {
-			auto element = internal::getAccessorElementAt<ElementType>(
-				accessor.componentType, &bytes[i * stride], accessor.normalized);
-			std::invoke(func, element);
-		}
-	}
+	iterateRange(first, last - first);
 }
+} // namespace internal
 
 FASTGLTF_EXPORT template <typename ElementType, typename Functor, typename BufferDataAdapter = DefaultBufferDataAdapter>
 #if FASTGLTF_HAS_CONCEPTS
 requires Element<ElementType> && std::is_invocable_v<Functor, ElementType, std::size_t>
 #endif
 void iterateAccessorWithIndex(const Asset& asset, const Accessor& accessor, Functor&& func,
-                     const BufferDataAdapter& adapter = {}) {
-	std::size_t idx = 0;
-	iterateAccessor<ElementType>(asset, accessor, [&](auto&& elementType) {
-		std::invoke(func, std::forward<ElementType>(elementType), idx++);
-	}, adapter);
-}
-
-FASTGLTF_EXPORT template <typename ElementType, std::size_t TargetStride = sizeof(ElementType),
-    typename BufferDataAdapter = DefaultBufferDataAdapter>
-#if FASTGLTF_HAS_CONCEPTS
-requires Element<ElementType>
-#endif
-void copyFromAccessor(const Asset& asset, const Accessor& accessor, void* dest,
 		const BufferDataAdapter& adapter = {}) {
 	using Traits = ElementTraits<ElementType>;
 	static_assert(Traits::type != AccessorType::Invalid, "Accessor traits must provide a valid accessor type");
@@ -789,31 +1141,95 @@ void copyFromAccessor(const Asset& asset, const Accessor& accessor, void* dest,
 
 	assert(accessor.type == Traits::type && "The destination type needs to have the same AccessorType as the accessor.");
 
-	auto* dstBytes = static_cast<std::byte*>(dest);
+	internal::iterateAccessorRange<ElementType>(asset, accessor, 0, accessor.count, func, adapter);
+}
 
-	if (accessor.sparse && accessor.sparse->count > 0) {
-		return iterateAccessorWithIndex<ElementType>(asset, accessor, [&](auto&& value, std::size_t index) {
-			auto* pDest = reinterpret_cast<ElementType*>(dstBytes + TargetStride * index);
-			*pDest = std::forward<ElementType>(value);
-		}, adapter);
+FASTGLTF_EXPORT template <typename ElementType, typename Functor, typename BufferDataAdapter = DefaultBufferDataAdapter>
+#if FASTGLTF_HAS_CONCEPTS
+requires Element<ElementType> && std::is_invocable_v<Functor, ElementType>
+#endif
+void iterateAccessor(const Asset& asset, const Accessor& accessor, Functor&& func,
+		const BufferDataAdapter& adapter = {}) {
+	iterateAccessorWithIndex<ElementType>(asset, accessor, [&](ElementType&& element, std::size_t) {
+		std::invoke(func, std::move(element));
+	}, adapter);
+}
+
+namespace internal {
+/**
+ * Copies count elements of the accessor's type from srcBytes into dstBytes, converting them if necessary.
+ */
+template <typename ElementType, std::size_t TargetStride>
+void copyAccessorElements(const Accessor& accessor, const std::byte* srcBytes, std::size_t srcStride, std::size_t count,
+		std::byte* dstBytes) {
+	using Traits = ElementTraits<ElementType>;
+	auto elemSize = getElementByteSize(accessor.type, accessor.componentType);
+
+    // If the data is normalized or the component/accessor type is different, we have to convert each element and can't memcpy.
+	if (std::is_trivially_copyable_v<ElementType> && !accessor.normalized && accessor.componentType == Traits::enum_component_type && !isMatrix(accessor.type)) {
+		if (srcStride == elemSize && srcStride == TargetStride) {
+			std::memcpy(dstBytes, srcBytes, elemSize * count);
+		} else {
+			copyStridedElements(srcBytes, srcStride, dstBytes, TargetStride, elemSize, count);
+		}
+		return;
 	}
 
+	// Quantized data and small indices are converted in batches, if the element type is laid out as its components.
+	using Component = typename Traits::component_type;
+	constexpr auto componentCount = getNumComponents(Traits::type);
+	if constexpr (std::is_trivially_copyable_v<ElementType> && !Traits::needs_transpose
+			&& sizeof(ElementType) == componentCount * sizeof(Component)
+			&& (std::is_same_v<Component, float> || std::is_same_v<Component, std::uint32_t>)) {
+		if (!isMatrix(accessor.type) && isBatchConvertible(accessor.componentType)) {
+			if constexpr (std::is_same_v<Component, float>) {
+				convertComponentsToFloat(srcBytes, srcStride, dstBytes, TargetStride,
+					componentCount, count, accessor.componentType, accessor.normalized);
+				return;
+			} else if (accessor.componentType == ComponentType::UnsignedByte || accessor.componentType == ComponentType::UnsignedShort) {
+				widenComponents(srcBytes, srcStride, dstBytes, TargetStride,
+					componentCount, count, accessor.componentType);
+				return;
+			}
+		}
+	}
+
+	auto store = [&](ElementType element, std::size_t i) {
+		*reinterpret_cast<ElementType*>(dstBytes + TargetStride * i) = std::move(element);
+	};
+	if (!readAccessorElements<ElementType>(accessor.componentType, accessor.normalized,
+			srcBytes, srcStride, count, store)) {
+		for (std::size_t i = 0; i < count; ++i) {
+			store(ElementType {}, i);
+		}
+	}
+}
+
+/**
+ * Copies the elements [first, first + count) of the accessor's dense data into dstBytes, which points
+ * to the destination of the whole accessor. Sparse values are not applied.
+ */
+template <typename ElementType, std::size_t TargetStride, typename BufferDataAdapter>
+void copyDenseAccessorElements(const Asset& asset, const Accessor& accessor, std::size_t first, std::size_t count,
+		std::byte* dstBytes, const BufferDataAdapter& adapter) {
 	auto elemSize = getElementByteSize(accessor.type, accessor.componentType);
 
+	dstBytes += TargetStride * first;
+
 	// 5.1.1. accessor.bufferView
 	// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
 	// property or extensions MAY override zeros with actual values.
 	if (!accessor.bufferViewIndex) {
 		if constexpr (std::is_trivially_copyable_v<ElementType>) {
 			if (TargetStride == elemSize) {
-				std::memset(dest, 0, elemSize * accessor.count);
+				std::memset(dstBytes, 0, elemSize * count);
 			} else {
-				for (std::size_t i = 0; i < accessor.count; ++i) {
+				for (std::size_t i = 0; i < count; ++i) {
 					std::memset(dstBytes + i * TargetStride, 0, elemSize);
 				}
 			}
 		} else {
-			for (std::size_t i = 0; i < accessor.count; ++i) {
+			for (std::size_t i = 0; i < count; ++i) {
 				auto* pDest = reinterpret_cast<ElementType*>(dstBytes + TargetStride * i);
 
 				if constexpr (std::is_aggregate_v<ElementType>) {
@@ -830,25 +1246,174 @@ void copyFromAccessor(const Asset& asset, const Accessor& accessor, void* dest,
 	auto& view = asset.bufferViews[*accessor.bufferViewIndex];
 	auto srcStride = view.byteStride.value_or(elemSize);
 
-	auto srcBytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
+	auto srcBytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset + srcStride * first);
+	copyAccessorElements<ElementType, TargetStride>(accessor, srcBytes.data(), srcStride, count, dstBytes);
+}
 
-    // If the data is normalized or the component/accessor type is different, we have to convert each element and can't memcpy.
-	if (std::is_trivially_copyable_v<ElementType> && !accessor.normalized && accessor.componentType == Traits::enum_component_type && !isMatrix(accessor.type)) {
-		if (srcStride == elemSize && srcStride == TargetStride) {
-			std::memcpy(dest, srcBytes.data(), elemSize * accessor.count);
+/**
+ * Writes the sparse values [first, first + count) of the accessor over the dense data in dstBytes.
+ */
+template <typename ElementType, std::size_t TargetStride, typename BufferDataAdapter>
+void scatterSparseAccessorElements(const Asset& asset, const Accessor& accessor, std::size_t first, std::size_t count,
+		std::byte* dstBytes, const BufferDataAdapter& adapter) {
+	auto indicesBytes = adapter(asset, accessor.sparse->indicesBufferView).subspan(accessor.sparse->indicesByteOffset);
+	auto indexStride = getElementByteSize(AccessorType::Scalar, accessor.sparse->indexComponentType);
+
+	auto valuesBytes = adapter(asset, accessor.sparse->valuesBufferView).subspan(accessor.sparse->valuesByteOffset);
+	// "The index of the bufferView with sparse values. The referenced buffer view MUST NOT
+	// have its target or byteStride properties defined."
+	auto valueStride = getElementByteSize(accessor.type, accessor.componentType);
+
+	// The indices and values are converted in blocks using the same bulk conversions as the dense data,
+	// after which the values only have to be written to their destinations.
+	constexpr std::size_t blockSize = 256;
+	std::uint32_t indices[blockSize];
+	ElementType values[blockSize];
+	const auto indexComponentType = accessor.sparse->indexComponentType;
+	for (std::size_t block = first; block < first + count; block += blockSize) {
+		const auto blockCount = std::min(blockSize, first + count - block);
+
+		const auto* blockIndices = &indicesBytes[indexStride * block];
+		if (indexComponentType == ComponentType::UnsignedInt) {
+			std::memcpy(indices, blockIndices, blockCount * sizeof(std::uint32_t));
+		} else if (indexComponentType == ComponentType::UnsignedByte || indexComponentType == ComponentType::UnsignedShort) {
+			widenComponents(blockIndices, indexStride, reinterpret_cast<std::byte*>(indices), sizeof(std::uint32_t),
+				1, blockCount, indexComponentType);
 		} else {
-			for (std::size_t i = 0; i < accessor.count; ++i) {
-				std::memcpy(dstBytes + TargetStride * i, &srcBytes[srcStride * i], elemSize);
+			for (std::size_t i = 0; i < blockCount; ++i) {
+				indices[i] = getAccessorElementAt<std::uint32_t>(indexComponentType, blockIndices + indexStride * i);
 			}
 		}
-	} else {
-		for (std::size_t i = 0; i < accessor.count; ++i) {
-			auto* pDest = reinterpret_cast<ElementType*>(dstBytes + TargetStride * i);
-			*pDest = internal::getAccessorElementAt<ElementType>(
-                    accessor.componentType, &srcBytes[srcStride * i]);
+
+		copyAccessorElements<ElementType, sizeof(ElementType)>(accessor, &valuesBytes[valueStride * block], valueStride,
+			blockCount, reinterpret_cast<std::byte*>(values));
+
+		for (std::size_t i = 0; i < blockCount; ++i) {
+			if (indices[i] >= accessor.count)
+				continue;
+			*reinterpret_cast<ElementType*>(dstBytes + TargetStride * indices[i]) = std::move(values[i]);
 		}
 	}
 }
+} // namespace internal
+
+FASTGLTF_EXPORT template <typename ElementType, std::size_t TargetStride = sizeof(ElementType),
+    typename BufferDataAdapter = DefaultBufferDataAdapter>
+#if FASTGLTF_HAS_CONCEPTS
+requires Element<ElementType>
+#endif
+void copyFromAccessor(const Asset& asset, const Accessor& accessor, void* dest,
+		const BufferDataAdapter& adapter = {}) {
+	using Traits = ElementTraits<ElementType>;
+	static_assert(Traits::type != AccessorType::Invalid, "Accessor traits must provide a valid accessor type");
+	static_assert(Traits::enum_component_type != ComponentType::Invalid, "Accessor traits must provide a valid component type");
+	static_assert(std::is_default_constructible_v<ElementType>, "Element type must be default constructible");
+	static_assert(std::is_constructible_v<ElementType>, "Element type must be constructible");
+	static_assert(std::is_move_assignable_v<ElementType>, "Element type must be move-assignable");
+
+	assert(accessor.type == Traits::type && "The destination type needs to have the same AccessorType as the accessor.");
+
+	auto* dstBytes = static_cast<std::byte*>(dest);
+
+	// Sparse accessors are copied in bulk like any other accessor, after which the sparse values are written on top.
+	internal::copyDenseAccessorElements<ElementType, TargetStride>(asset, accessor, 0, accessor.count, dstBytes, adapter);
+	if (accessor.sparse && accessor.sparse->count > 0) {
+		internal::scatterSparseAccessorElements<ElementType, TargetStride>(asset, accessor, 0, accessor.sparse->count,
+			dstBytes, adapter);
+	}
+}
+
+/**
+ * Number of elements read or written by a single task of the parallel accessor functions. This is a
+ * multiple of 64, so that the chunks of two tasks never share a cache line of an aligned destination.
+ */
+FASTGLTF_EXPORT inline constexpr std::size_t parallelAccessorChunkSize = 64 * 1024;
+
+/**
+ * Accessors with fewer elements than this are always processed on the calling thread by the parallel
+ * accessor functions, as spinning up tasks is not worth it for them.
+ */
+FASTGLTF_EXPORT inline constexpr std::size_t parallelAccessorThreshold = 4 * parallelAccessorChunkSize;
+
+/**
+ * Same as iterateAccessorWithIndex, but splits the accessor into chunks of parallelAccessorChunkSize
+ * elements, which are each run as a separate task using the given callback. func is therefore called
+ * concurrently from multiple threads, though never twice with the same index. Small accessors, or
+ * when no callback is given, are iterated on the calling thread.
+ */
+FASTGLTF_EXPORT template <typename ElementType, typename Functor, typename BufferDataAdapter = DefaultBufferDataAdapter>
+#if FASTGLTF_HAS_CONCEPTS
+requires Element<ElementType> && std::is_invocable_v<Functor, ElementType, std::size_t>
+#endif
+void parallelIterateAccessorWithIndex(const Asset& asset, const Accessor& accessor, Functor&& func,
+		ParallelTaskCallback* taskCallback, void* userPointer, const BufferDataAdapter& adapter = {}) {
+	const auto chunkCount = (accessor.count + parallelAccessorChunkSize - 1) / parallelAccessorChunkSize;
+	if (taskCallback == nullptr || accessor.count < parallelAccessorThreshold || chunkCount < 2) {
+		iterateAccessorWithIndex<ElementType>(asset, accessor, func, adapter);
+		return;
+	}
+
+	assert(accessor.type == ElementTraits<ElementType>::type && "The destination type needs to have the same AccessorType as the accessor.");
+
+	struct TaskData {
+		const Asset& asset;
+		const Accessor& accessor;
+		std::remove_reference_t<Functor>& func;
+		const BufferDataAdapter& adapter;
+	} taskData { asset, accessor, func, adapter };
+
+	taskCallback(chunkCount, [](std::size_t chunkIndex, void* data) {
+		auto& task = *static_cast<TaskData*>(data);
+		const auto first = chunkIndex * parallelAccessorChunkSize;
+		const auto last = std::min(first + parallelAccessorChunkSize, task.accessor.count);
+		internal::iterateAccessorRange<ElementType>(task.asset, task.accessor, first, last, task.func, task.adapter);
+	}, &taskData, userPointer);
+}
+
+/**
+ * Same as copyFromAccessor, but splits the accessor into chunks of parallelAccessorChunkSize elements,
+ * which are each copied as a separate task using the given callback. For sparse accessors the dense
+ * data is copied first, after which the sparse values are written on the calling thread. The result is
+ * identical to copyFromAccessor. Small accessors, or when no callback is given, are copied on the calling thread.
+ */
+FASTGLTF_EXPORT template <typename ElementType, std::size_t TargetStride = sizeof(ElementType),
+	typename BufferDataAdapter = DefaultBufferDataAdapter>
+#if FASTGLTF_HAS_CONCEPTS
+requires Element<ElementType>
+#endif
+void parallelCopyFromAccessor(const Asset& asset, const Accessor& accessor, void* dest,
+		ParallelTaskCallback* taskCallback, void* userPointer, const BufferDataAdapter& adapter = {}) {
+	const auto chunkCount = (accessor.count + parallelAccessorChunkSize - 1) / parallelAccessorChunkSize;
+	if (taskCallback == nullptr || accessor.count < parallelAccessorThreshold || chunkCount < 2) {
+		copyFromAccessor<ElementType, TargetStride>(asset, accessor, dest, adapter);
+		return;
+	}
+
+	assert(accessor.type == ElementTraits<ElementType>::type && "The destination type needs to have the same AccessorType as the accessor.");
+
+	struct TaskData {
+		const Asset& asset;
+		const Accessor& accessor;
+		std::byte* dstBytes;
+		const BufferDataAdapter& adapter;
+	} taskData { asset, accessor, static_cast<std::byte*>(dest), adapter };
+
+	taskCallback(chunkCount, [](std::size_t chunkIndex, void* data) {
+		auto& task = *static_cast<TaskData*>(data);
+		const auto first = chunkIndex * parallelAccessorChunkSize;
+		const auto count = std::min(parallelAccessorChunkSize, task.accessor.count - first);
+		internal::copyDenseAccessorElements<ElementType, TargetStride>(task.asset, task.accessor, first, count,
+			task.dstBytes, task.adapter);
+	}, &taskData, userPointer);
+
+	// The sparse values are written serially once all of the dense data has been copied. The spec
+	// requires the sparse indices to be strictly increasing, but a file violating that would otherwise
+	// have multiple tasks write to the same element, and the last sparse value has to win.
+	if (accessor.sparse && accessor.sparse->count > 0) {
+		internal::scatterSparseAccessorElements<ElementType, TargetStride>(asset, accessor, 0, accessor.sparse->count,
+			static_cast<std::byte*>(dest), adapter);
+	}
+}
 
 /**
  * This function allows copying each component into a linear list, instead of copying per-element,
@@ -876,21 +1441,116 @@ void copyComponentsFromAccessor(const Asset& asset, const Accessor& accessor, vo
 		if (srcStride == elemSize) {
 			std::memcpy(dest, srcBytes.data(), elemSize * accessor.count);
 		} else {
-			for (std::size_t i = 0; i < accessor.count; ++i) {
-				std::memcpy(dstBytes + elemSize * i, &srcBytes[srcStride * i], elemSize);
+			internal::copyStridedElements(srcBytes.data(), srcStride, dstBytes, elemSize, elemSize, accessor.count);
+		}
+		return;
+	}
+
+	// The destination is always tightly packed, regardless of the source component size.
+	const auto dstElemSize = componentCount * sizeof(ComponentType);
+	if (!isMatrix(accessor.type) && internal::isBatchConvertible(accessor.componentType)) {
+		if constexpr (std::is_same_v<ComponentType, float>) {
+			internal::convertComponentsToFloat(srcBytes.data(), srcStride, dstBytes, dstElemSize,
+				componentCount, accessor.count, accessor.componentType, accessor.normalized);
+			return;
+		} else if constexpr (std::is_same_v<ComponentType, std::uint32_t>) {
+			if (accessor.componentType == fastgltf::ComponentType::UnsignedByte || accessor.componentType == fastgltf::ComponentType::UnsignedShort) {
+				internal::widenComponents(srcBytes.data(), srcStride, dstBytes, dstElemSize,
+					componentCount, accessor.count, accessor.componentType);
+				return;
 			}
 		}
-	} else {
+	}
+
+	const bool dispatched = internal::dispatchComponentType(accessor.componentType, [&](auto tag) {
+		using SourceType = typename decltype(tag)::type;
 		for (std::size_t i = 0; i < accessor.count; ++i) {
+			auto* pDest = reinterpret_cast<ComponentType*>(dstBytes + dstElemSize * i);
 			for (std::size_t j = 0; j < componentCount; ++j) {
-				auto* pDest = reinterpret_cast<ComponentType*>(dstBytes + elemSize * i) + j;
-				*pDest = internal::getAccessorComponentAt<ComponentType>(
-					accessor.componentType, accessor.type, &srcBytes[i * srcStride], j, accessor.normalized);
+				pDest[j] = internal::convertComponent<ComponentType, SourceType>(
+					&srcBytes[i * srcStride], j, accessor.type, accessor.normalized);
 			}
 		}
+	});
+	if (!dispatched) {
+		std::memset(dest, 0, dstElemSize * accessor.count);
 	}
 }
 
+namespace internal {
+/** The data of a single morph target accessor, as read by blendMorphTargets. */
+struct MorphTargetData {
+	float weight;
+	std::size_t count;
+
+	// The dense displacements, or nullptr if the accessor has no buffer view and is therefore all zeros.
+	const std::byte* data;
+	std::size_t byteStride;
+	ComponentType componentType;
+	bool normalized;
+
+	// The sparse displacements, which replace the dense ones at the given indices.
+	std::size_t sparseCount;
+	const std::byte* sparseIndices;
+	ComponentType sparseIndexComponentType;
+	const std::byte* sparseValues;
+};
+
+void blendMorphTargets(const MorphTargetData* targets, std::size_t targetCount, math::fvec3* destination, std::size_t count);
+} // namespace internal
+
+/**
+ * Adds the displacements of all morph targets of the primitive for the given attribute, multiplied by
+ * their weight, to the destination, which usually contains the base values of the attribute. This is
+ * meant for the POSITION, NORMAL, and TANGENT attributes, of which only the XYZ components of tangents
+ * are displaced. Targets with a weight of zero are skipped, and sparse targets only read and modify
+ * the vertices they displace. The dense targets are added to small blocks of vertices at a time, so
+ * that every block stays in cache, using AVX2, SSE4, or Neon when the CPU supports them. FMA is not
+ * used, so every kernel rounds exactly like the scalar fallback.
+ */
+FASTGLTF_EXPORT template <typename BufferDataAdapter = DefaultBufferDataAdapter>
+void blendMorphTargets(const Asset& asset, const Primitive& primitive, std::string_view attribute,
+		span<const float> weights, span<math::fvec3> destination, const BufferDataAdapter& adapter = {}) {
+	SmallVector<internal::MorphTargetData, 8> targets;
+	// The data returned by the adapter has to stay alive until the targets have been blended.
+	SmallVector<internal::BufferDataAdapterResult<BufferDataAdapter>, 8> targetData;
+	const auto targetCount = std::min(weights.size(), primitive.targets.size());
+	for (std::size_t i = 0; i < targetCount; ++i) {
+		if (weights[i] == 0.f)
+			continue;
+
+		const auto* it = primitive.findTargetAttribute(i, attribute);
+		if (it == primitive.targets[i].cend())
+			continue;
+
+		const auto& accessor = asset.accessors[it->accessorIndex];
+		if (accessor.type != AccessorType::Vec3)
+			continue;
+
+		auto& target = targets.emplace_back();
+		target.weight = weights[i];
+		target.count = std::min(accessor.count, destination.size());
+		if (accessor.bufferViewIndex.has_value()) {
+			const auto& view = asset.bufferViews[*accessor.bufferViewIndex];
+			target.data = targetData.emplace_back(adapter(asset, *accessor.bufferViewIndex)).subspan(accessor.byteOffset).data();
+			target.byteStride = view.byteStride.value_or(getElementByteSize(accessor.type, accessor.componentType));
+		}
+		target.componentType = accessor.componentType;
+		target.normalized = accessor.normalized;
+
+		if (accessor.sparse && accessor.sparse->count > 0) {
+			target.sparseCount = accessor.sparse->count;
+			target.sparseIndices = targetData.emplace_back(adapter(asset, accessor.sparse->indicesBufferView))
+				.subspan(accessor.sparse->indicesByteOffset).data();
+			target.sparseIndexComponentType = accessor.sparse->indexComponentType;
+			target.sparseValues = targetData.emplace_back(adapter(asset, accessor.sparse->valuesBufferView))
+				.subspan(accessor.sparse->valuesByteOffset).data();
+		}
+	}
+
+	internal::blendMorphTargets(targets.data(), targets.size(), destination.data(), destination.size());
+}
+
 /**
  * Computes the transform matrix for a given node, and multiplies the given base with that matrix.
  */
@@ -934,4 +1594,328 @@ void iterateSceneNodes(AssetType&& asset, std::size_t sceneIndex, math::fmat4x4
 	}
 }
 
+/**
+ * The nodes of a scene flattened into an order in which every node comes after its parent. This is
+ * built once for a scene, and allows computing the world transforms of all of its nodes in a single
+ * loop, without recursion. The nodes are ordered by their depth in the hierarchy, and by their index
+ * within each level. Nodes which are reachable multiple times, or through a cycle, are only included once.
+ */
+FASTGLTF_EXPORT class SceneHierarchy {
+	std::vector<std::size_t> nodeIndices;
+	std::vector<std::size_t> parentIndices;
+
+public:
+	static constexpr std::size_t noParent = std::numeric_limits<std::size_t>::max();
+
+	SceneHierarchy() = default;
+	explicit SceneHierarchy(const Asset& asset, std::size_t sceneIndex);
+
+	/** The indices of all nodes of the scene, with every parent before its children. */
+	[[nodiscard]] span<const std::size_t> nodes() const noexcept {
+		return span(nodeIndices.data(), nodeIndices.size());
+	}
+
+	/** The index of the parent node for each entry of nodes(), or noParent for the root nodes of the scene. */
+	[[nodiscard]] span<const std::size_t> parents() const noexcept {
+		return span(parentIndices.data(), parentIndices.size());
+	}
+
+	[[nodiscard]] std::size_t size() const noexcept {
+		return nodeIndices.size();
+	}
+};
+
+/**
+ * Computes the world space transform of every node in the hierarchy, just like iterateSceneNodes,
+ * and writes it into worldMatrices at the index of the node. worldMatrices therefore needs to have at
+ * least as many elements as the asset has nodes, and matrices of nodes which are not part of the
+ * scene are left untouched. This uses SSE4 or Neon when the CPU supports it at runtime.
+ */
+FASTGLTF_EXPORT void computeWorldTransforms(const Asset& asset, const SceneHierarchy& hierarchy,
+		span<math::fmat4x4> worldMatrices, const math::fmat4x4& initial = math::fmat4x4());
+
+/**
+ * A persistent cache of the local and world transforms of all nodes of a scene, for when only a few
+ * nodes change between frames, e.g. due to animations. The local transforms are stored as separate
+ * arrays of translations, rotations, and scales, and every change marks the node as dirty. update()
+ * then only recomputes the world matrices of the dirty nodes and their descendants.
+ *
+ * All functions take node indices, and the world matrices are indexed by node just like with
+ * computeWorldTransforms. Nodes which are not part of the scene keep an identity world matrix.
+ */
+FASTGLTF_EXPORT class TransformCache {
+	// The nodes in depth-first order, so that the subtree of each node is a contiguous range.
+	std::vector<std::size_t> order;
+	std::vector<std::size_t> parents;
+	std::vector<std::size_t> subtreeEnds;
+	// The position of every node in order, or notInScene.
+	std::vector<std::size_t> positions;
+
+	std::vector<math::fvec3> nodeTranslations;
+	std::vector<math::fquat> nodeRotations;
+	std::vector<math::fvec3> nodeScales;
+	// Nodes using a matrix transform keep that matrix as their local matrix, until a TRS component is
+	// set. The other components then keep the values decomposed from the matrix.
+	std::vector<bool> matrixNodes;
+	std::vector<math::fmat4x4> localMatrices;
+	std::vector<math::fmat4x4> worldMatrices;
+	math::fmat4x4 initial;
+
+	std::vector<std::uint64_t> dirtyBits;
+	std::vector<std::size_t> dirtyNodes;
+
+	void markDirty(std::size_t nodeIndex) noexcept;
+
+public:
+	static constexpr std::size_t notInScene = std::numeric_limits<std::size_t>::max();
+
+	TransformCache() = default;
+
+	/** Builds the cache from the current transforms of the nodes, and computes all world matrices. */
+	explicit TransformCache(const Asset& asset, std::size_t sceneIndex, const math::fmat4x4& initial = math::fmat4x4());
+
+	void setTranslation(std::size_t nodeIndex, const math::fvec3& translation);
+	void setRotation(std::size_t nodeIndex, const math::fquat& rotation);
+	void setScale(std::size_t nodeIndex, const math::fvec3& scale);
+	void setTRS(std::size_t nodeIndex, const TRS& trs);
+	void setMatrix(std::size_t nodeIndex, const math::fmat4x4& matrix);
+
+	/** Sets the translations of many nodes at once. Both spans need to have the same size. */
+	void setTranslations(span<const std::size_t> nodeIndices, span<const math::fvec3> translations);
+	void setRotations(span<const std::size_t> nodeIndices, span<const math::fquat> rotations);
+	void setScales(span<const std::size_t> nodeIndices, span<const math::fvec3> scales);
+
+	/** Returns true if the local transform of the node changed since the last update. */
+	[[nodiscard]] bool isDirty(std::size_t nodeIndex) const noexcept {
+		return (dirtyBits[nodeIndex / 64] >> (nodeIndex % 64)) & 1U;
+	}
+
+	/**
+	 * Recomputes the world matrices of all dirty nodes and their descendants, and returns the amount
+	 * of world matrices which were recomputed.
+	 */
+	std::size_t update();
+
+	[[nodiscard]] span<const math::fvec3> translations() const noexcept {
+		return span(nodeTranslations.data(), nodeTranslations.size());
+	}
+	[[nodiscard]] span<const math::fquat> rotations() const noexcept {
+		return span(nodeRotations.data(), nodeRotations.size());
+	}
+	[[nodiscard]] span<const math::fvec3> scales() const noexcept {
+		return span(nodeScales.data(), nodeScales.size());
+	}
+
+	/** The world matrices of all nodes, which do not reflect any changes made since the last update(). */
+	[[nodiscard]] span<const math::fmat4x4> worlds() const noexcept {
+		return span(worldMatrices.data(), worldMatrices.size());
+	}
+	[[nodiscard]] const math::fmat4x4& world(std::size_t nodeIndex) const noexcept {
+		return worldMatrices[nodeIndex];
+	}
+};
+
+/**
+ * Caches the joints and decoded inverse bind matrices of every skin of an asset, to compute the joint
+ * matrices used for skinning from the world matrices of the nodes. The world matrices are indexed by
+ * node, as computed by computeWorldTransforms or TransformCache. As the cache is only read when
+ * computing joint matrices, a single cache can be shared by any number of instances of the asset.
+ */
+FASTGLTF_EXPORT class SkinningCache {
+	// The joints and inverse bind matrices of all skins, with the ones of skin i starting at offsets[i].
+	std::vector<std::size_t> offsets;
+	std::vector<std::size_t> jointIndices;
+	std::vector<math::fmat4x4> inverseBindMatrices;
+
+public:
+	SkinningCache() = default;
+
+	/** Decodes the inverse bind matrices of all skins. Skins without any use identity matrices. */
+	template <typename BufferDataAdapter = DefaultBufferDataAdapter>
+	explicit SkinningCache(const Asset& asset, const BufferDataAdapter& adapter = {}) {
+		offsets.reserve(asset.skins.size() + 1);
+		offsets.emplace_back(0);
+		for (const auto& skin : asset.skins) {
+			const auto offset = jointIndices.size();
+			jointIndices.insert(jointIndices.end(), skin.joints.begin(), skin.joints.end());
+
+			if (skin.inverseBindMatrices.has_value()) {
+				const auto& accessor = asset.accessors[*skin.inverseBindMatrices];
+				if (accessor.type == AccessorType::Mat4 && accessor.count >= skin.joints.size()) {
+					// copyFromAccessor writes all elements, of which there may be more than there are joints.
+					inverseBindMatrices.resize(offset + accessor.count);
+					copyFromAccessor<math::fmat4x4>(asset, accessor, &inverseBindMatrices[offset], adapter);
+				}
+			}
+			inverseBindMatrices.resize(jointIndices.size());
+			offsets.emplace_back(jointIndices.size());
+		}
+	}
+
+	[[nodiscard]] std::size_t skinCount() const noexcept {
+		return offsets.empty() ? 0 : offsets.size() - 1;
+	}
+
+	/** The number of joints of all skins, which is the size of the palette for computeAllJointMatrices. */
+	[[nodiscard]] std::size_t totalJointCount() const noexcept {
+		return jointIndices.size();
+	}
+
+	/** The position of the first joint of the skin within the palette computed by computeAllJointMatrices. */
+	[[nodiscard]] std::size_t jointOffset(std::size_t skinIndex) const noexcept {
+		return offsets[skinIndex];
+	}
+
+	[[nodiscard]] span<const std::size_t> joints(std::size_t skinIndex) const noexcept {
+		return span(jointIndices.data() + offsets[skinIndex], offsets[skinIndex + 1] - offsets[skinIndex]);
+	}
+
+	[[nodiscard]] span<const math::fmat4x4> inverseBinds(std::size_t skinIndex) const noexcept {
+		return span(inverseBindMatrices.data() + offsets[skinIndex], offsets[skinIndex + 1] - offsets[skinIndex]);
+	}
+
+	/**
+	 * Computes the joint matrix worldMatrices[joints[j]] * inverseBindMatrices[j] for every joint j of
+	 * the skin. jointMatrices needs to have room for as many matrices as the skin has joints. Multiply
+	 * the joint matrices with the inverse world matrix of the skinned mesh node to get the matrices
+	 * relative to the mesh. This uses SSE4 or Neon when the CPU supports it at runtime, and works best
+	 * when jointMatrices is aligned to 16 bytes.
+	 */
+	void computeJointMatrices(std::size_t skinIndex, span<const math::fmat4x4> worldMatrices, span<math::fmat4x4> jointMatrices) const;
+
+	/** Computes the joint matrices of all skins at once, with the matrices of each skin starting at jointOffset. */
+	void computeAllJointMatrices(span<const math::fmat4x4> worldMatrices, span<math::fmat4x4> jointMatrices) const;
+};
+
+/**
+ * Evaluates all channels of an animation at a given point in time. The keyframe times and values of
+ * every sampler are decoded into contiguous float arrays once when constructing the evaluator. Every
+ * channel also remembers the keyframe it last used, so that playing an animation forwards only has to
+ * look at the next few keyframes, instead of searching through all of them on every frame.
+ *
+ * Channels which do not target a node, or whose sampler output does not match the targeted path,
+ * are ignored.
+ */
+FASTGLTF_EXPORT class AnimationEvaluator {
+	struct Sampler {
+		AnimationInterpolation interpolation = AnimationInterpolation::Linear;
+		std::size_t keyCount = 0;
+		std::size_t timeOffset = 0;
+		std::size_t valueOffset = 0;
+		// The number of floats per element of the output accessor, and the number of floats in total.
+		std::size_t componentCount = 0;
+		std::size_t valueCount = 0;
+	};
+
+	struct Channel {
+		std::size_t samplerIndex;
+		std::size_t nodeIndex;
+		AnimationPath path;
+		// The number of floats per keyframe value, which for weights is the number of morph targets.
+		std::size_t width;
+		std::size_t resultOffset;
+		std::size_t cursor;
+	};
+
+	std::vector<Sampler> samplers;
+	std::vector<Channel> channels;
+	std::vector<float> times;
+	std::vector<float> values;
+	std::vector<float> results;
+	float startTime = 0.f;
+	float endTime = 0.f;
+
+	void addChannels(const Asset& asset, const Animation& animation);
+
+public:
+	AnimationEvaluator() = default;
+
+	/** Decodes the samplers of the animation, and evaluates all channels at the start of the animation. */
+	template <typename BufferDataAdapter = DefaultBufferDataAdapter>
+	explicit AnimationEvaluator(const Asset& asset, std::size_t animationIndex, const BufferDataAdapter& adapter = {}) {
+		const auto& animation = asset.animations[animationIndex];
+		samplers.reserve(animation.samplers.size());
+		for (const auto& sampler : animation.samplers) {
+			auto& decoded = samplers.emplace_back();
+			decoded.interpolation = sampler.interpolation;
+
+			const auto& input = asset.accessors[sampler.inputAccessor];
+			const auto& output = asset.accessors[sampler.outputAccessor];
+			if (input.type != AccessorType::Scalar || input.count == 0)
+				continue;
+
+			decoded.componentCount = getNumComponents(output.type);
+			decoded.valueCount = output.count * decoded.componentCount;
+			decoded.valueOffset = values.size();
+			values.resize(values.size() + decoded.valueCount);
+			switch (output.type) {
+				case AccessorType::Scalar:
+					copyFromAccessor<float>(asset, output, &values[decoded.valueOffset], adapter);
+					break;
+				case AccessorType::Vec3:
+					copyFromAccessor<math::fvec3>(asset, output, &values[decoded.valueOffset], adapter);
+					break;
+				case AccessorType::Vec4:
+					copyFromAccessor<math::fvec4>(asset, output, &values[decoded.valueOffset], adapter);
+					break;
+				default:
+					values.resize(decoded.valueOffset);
+					decoded.valueCount = 0;
+					continue;
+			}
+
+			decoded.keyCount = input.count;
+			decoded.timeOffset = times.size();
+			times.resize(times.size() + input.count);
+			copyFromAccessor<float>(asset, input, &times[decoded.timeOffset], adapter);
+		}
+
+		addChannels(asset, animation);
+	}
+
+	/**
+	 * Evaluates all channels at the given time, using the interpolation of their sampler. Times outside
+	 * of the keyframes of a sampler are clamped to its first or last keyframe. Rotations are always
+	 * normalized. Seeking backwards is supported, but is slower than moving forwards.
+	 */
+	void evaluate(float time);
+
+	/**
+	 * Writes the values of the last evaluate() call into the TRS and morph target weights of the
+	 * targeted nodes. Nodes using a matrix transform are decomposed into TRS first.
+	 */
+	void apply(Asset& asset) const;
+
+	/** Same as apply(Asset&), but sets the local transforms in the cache. Weights are ignored. */
+	void apply(TransformCache& cache) const;
+
+	/** The time of the first and last keyframe over all channels. */
+	[[nodiscard]] float minTime() const noexcept {
+		return startTime;
+	}
+	[[nodiscard]] float maxTime() const noexcept {
+		return endTime;
+	}
+
+	/** The number of channels which are evaluated. */
+	[[nodiscard]] std::size_t size() const noexcept {
+		return channels.size();
+	}
+
+	[[nodiscard]] std::size_t nodeIndex(std::size_t channel) const noexcept {
+		return channels[channel].nodeIndex;
+	}
+	[[nodiscard]] AnimationPath path(std::size_t channel) const noexcept {
+		return channels[channel].path;
+	}
+
+	/**
+	 * The value of the channel from the last evaluate() call. These are 3 floats for translations and
+	 * scales, 4 floats for rotations, and one float per morph target for weights.
+	 */
+	[[nodiscard]] span<const float> value(std::size_t channel) const noexcept {
+		return span(results.data() + channels[channel].resultOffset, channels[channel].width);
+	}
+};
+
 } // namespace fastgltf
@@ -1555,6 +1555,13 @@ namespace fastgltf {
 
     FASTGLTF_EXPORT using CustomBufferId = std::uint64_t;
 
+	/**
+	 * Callback used to run independent work items on a user-controlled thread pool or job system.
+	 * The callback has to invoke task(i, taskData) exactly once for every i in [0, taskCount), in any
+	 * order and on any thread, and may only return once all of these invocations have finished.
+	 */
+	FASTGLTF_EXPORT using ParallelTaskCallback = void(std::size_t taskCount, void (*task)(std::size_t taskIndex, void* taskData), void* taskData, void* userPointer);
+
     /**
      * Namespace for structs that describe individual sources of data for images and/or buffers.
      */
@@ -2170,7 +2177,7 @@ namespace fastgltf {
         FASTGLTF_STD_PMR_NS::string name;
     };
 
-	class ChunkMemoryResource;
+	FASTGLTF_EXPORT class ChunkMemoryResource;
 	FASTGLTF_EXPORT class Parser;
 
 	FASTGLTF_EXPORT class Asset {
@@ -2179,9 +2186,15 @@ namespace fastgltf {
 #if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
 		// This has to be first in this struct so that it gets destroyed last, leaving all allocations
 		// alive until the end.
-		std::shared_ptr<std::pmr::monotonic_buffer_resource> memoryResource;
+		std::shared_ptr<ChunkMemoryResource> memoryResource;
+
+		// Additional arenas that were used by each task when the categories were parsed in parallel.
+		std::vector<std::shared_ptr<ChunkMemoryResource>> taskMemoryResources;
 #endif
 
+		// Keeps memory alive which sources::ByteView instances in this asset point into, e.g. memory mapped files.
+		std::vector<std::shared_ptr<const void>> sharedStorage;
+
 	public:
         /**
          * This will only ever have no value if #Options::DontRequireValidAssetMember was specified.
@@ -2216,7 +2229,9 @@ namespace fastgltf {
         Asset(Asset&& other) noexcept :
 #if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
 				memoryResource(std::move(other.memoryResource)),
+				taskMemoryResources(std::move(other.taskMemoryResources)),
 #endif
+				sharedStorage(std::move(other.sharedStorage)),
 				assetInfo(std::move(other.assetInfo)),
 				extensionsUsed(std::move(other.extensionsUsed)),
 				extensionsRequired(std::move(other.extensionsRequired)),
@@ -2263,7 +2278,9 @@ namespace fastgltf {
 #if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
 			// This needs to be last to not destroy the old memoryResource for the current data.
 			memoryResource = std::move(other.memoryResource);
+			taskMemoryResources = std::move(other.taskMemoryResources);
 #endif
+			sharedStorage = std::move(other.sharedStorage);
 			return *this;
 		}
     };
@@ -307,13 +307,13 @@ namespace fastgltf {
 #if FASTGLTF_HAS_BIT
 		return static_cast<std::uint8_t>(std::popcount(value));
 #else
-		std::uint8_t bits = 0;
-		while (value) {
-			if (value & 1)
-				++bits;
-			value >>= 1;
-		}
-		return bits;
+		// Parallel bit count, which compilers turn into a popcnt instruction where available.
+		static_assert(sizeof(T) <= sizeof(std::uint64_t));
+		std::uint64_t bits = static_cast<std::make_unsigned_t<T>>(value);
+		bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+		bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+		bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return static_cast<std::uint8_t>((bits * 0x0101010101010101ULL) >> 56);
 #endif
 	}
 
@@ -430,6 +430,37 @@ void fg::base64::decode_inplace(std::string_view encoded, std::uint8_t* output,
     return DecodeFunctionGetter::get()->inplace(encoded, output, padding);
 }
 
+void fg::base64::parallel_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding,
+		ParallelTaskCallback* taskCallback, void* userPointer, std::size_t threshold) {
+    assert(encoded.size() % 4 == 0);
+
+	// Spinning up tasks is not worth it for small inputs, which also need at least two chunks.
+	const auto chunkCount = encoded.size() / parallelDecodeChunkSize;
+	if (taskCallback == nullptr || encoded.size() < threshold || chunkCount < 2) {
+		decode_inplace(encoded, output, padding);
+		return;
+	}
+
+	struct DecodeChunks {
+		std::string_view encoded;
+		std::uint8_t* output;
+		std::size_t padding;
+		std::size_t chunkCount;
+		DecodeFunctionGetter* getter;
+	} chunks { encoded, output, padding, chunkCount, DecodeFunctionGetter::get() };
+
+	// Every chunk is 4-byte aligned, so its output starts at a multiple of 3 bytes. Only the last
+	// chunk, which also takes the remaining characters, contains the padding.
+	taskCallback(chunkCount, [](std::size_t chunkIndex, void* data) {
+		auto& chunks = *static_cast<DecodeChunks*>(data);
+		const auto start = chunkIndex * parallelDecodeChunkSize;
+		const bool isLast = chunkIndex + 1 == chunks.chunkCount;
+		const auto size = isLast ? chunks.encoded.size() - start : parallelDecodeChunkSize;
+		chunks.getter->inplace(chunks.encoded.substr(start, size), chunks.output + (start / 4) * 3,
+							   isLast ? chunks.padding : 0);
+	}, &chunks, userPointer);
+}
+
 fg::StaticVector<std::uint8_t> fg::base64::decode(std::string_view encoded) {
     assert(encoded.size() % 4 == 0);
 
@@ -31,6 +31,7 @@
 #include <fstream>
 #include <functional>
 #include <mutex>
+#include <unordered_map>
 #include <utility>
 
 #ifdef _MSC_VER
@@ -49,6 +50,7 @@ static_assert(std::string_view { SIMDJSON_TARGET_VERSION } == SIMDJSON_VERSION,
 
 #include <fastgltf/core.hpp>
 #include <fastgltf/base64.hpp>
+#include <fastgltf/meshopt.hpp>
 
 #if defined(FASTGLTF_IS_X86)
 #include <nmmintrin.h> // SSE4.2 for the CRC-32C instructions
@@ -63,6 +65,62 @@ static_assert(std::string_view { SIMDJSON_TARGET_VERSION } == SIMDJSON_VERSION,
 namespace fg = fastgltf;
 namespace fs = std::filesystem;
 
+#if FASTGLTF_ENABLE_STATISTICS
+namespace fastgltf {
+	/**
+	 * Adds the time spent, the arena allocations, and the JSON written during its lifetime to the given statistics.
+	 */
+	class StatisticsScope {
+		CategoryStatistics& statistics;
+		const ChunkMemoryResource* resource = nullptr;
+		const std::string* json = nullptr;
+		std::uint64_t allocationCount = 0;
+		std::uint64_t allocatedBytes = 0;
+		std::size_t jsonSize = 0;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	public:
+		explicit StatisticsScope(CategoryStatistics& statistics, [[maybe_unused]] const ChunkMemoryResource* resource) noexcept : statistics(statistics), resource(resource) {
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+			if (resource != nullptr) {
+				allocationCount = resource->allocationCount();
+				allocatedBytes = resource->allocatedBytes();
+			}
+#endif
+		}
+
+		explicit StatisticsScope(CategoryStatistics& statistics, const std::string& json) noexcept
+				: statistics(statistics), json(&json), jsonSize(json.size()) {}
+
+		StatisticsScope(const StatisticsScope& other) = delete;
+		StatisticsScope& operator=(const StatisticsScope& other) = delete;
+
+		~StatisticsScope() noexcept {
+			statistics.duration += std::chrono::steady_clock::now() - start;
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+			if (resource != nullptr) {
+				statistics.allocationCount += resource->allocationCount() - allocationCount;
+				statistics.allocatedBytes += resource->allocatedBytes() - allocatedBytes;
+			}
+#endif
+			if (json != nullptr) {
+				statistics.writtenBytes += json->size() - jsonSize;
+			}
+		}
+	};
+} // namespace fastgltf
+
+#define FASTGLTF_IF_STATISTICS(...) __VA_ARGS__
+#else
+#define FASTGLTF_IF_STATISTICS(...)
+#endif
+
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+#define FASTGLTF_PARSER_MEMORY_RESOURCE(parser) (parser).resourceAllocator.get()
+#else
+#define FASTGLTF_PARSER_MEMORY_RESOURCE(parser) nullptr
+#endif
+
 namespace fastgltf {
     constexpr std::uint32_t binaryGltfHeaderMagic = 0x46546C67; // ASCII for "glTF".
     constexpr std::uint32_t binaryGltfJsonChunkMagic = 0x4E4F534A;
@@ -719,7 +777,8 @@ fg::Expected<fg::DataSource> fg::Parser::decodeDataUri(URIView& uri) const noexc
             if (config.decodeCallback != nullptr) {
                 config.decodeCallback(encodedData, reinterpret_cast<std::uint8_t*>(info.mappedMemory), padding, size, config.userPointer);
             } else {
-                base64::decode_inplace(encodedData, reinterpret_cast<std::uint8_t*>(info.mappedMemory), padding);
+                base64::parallel_decode_inplace(encodedData, reinterpret_cast<std::uint8_t*>(info.mappedMemory), padding,
+												config.parallelTaskCallback, config.userPointer);
             }
 
             if (config.unmapCallback != nullptr) {
@@ -739,7 +798,8 @@ fg::Expected<fg::DataSource> fg::Parser::decodeDataUri(URIView& uri) const noexc
 	if (config.decodeCallback != nullptr) {
 		config.decodeCallback(encodedData, reinterpret_cast<std::uint8_t*>(uriData.data()), padding, uriData.size(), config.userPointer);
 	} else {
-		base64::decode_inplace(encodedData, reinterpret_cast<std::uint8_t*>(uriData.data()), padding);
+		base64::parallel_decode_inplace(encodedData, reinterpret_cast<std::uint8_t*>(uriData.data()), padding,
+										config.parallelTaskCallback, config.userPointer);
 	}
 
 	sources::Array source {
@@ -837,59 +897,354 @@ template fg::Error fg::Parser::parseAttributes(simdjson::dom::object&, FASTGLTF_
 template fg::Error fg::Parser::parseAttributes(simdjson::dom::object&, decltype(fastgltf::Primitive::attributes)&);
 
 namespace fastgltf {
-	template<typename T>
-	void writeIndices(PrimitiveType type, span<T> indices, std::size_t primitiveCount) {
-		// Generate the correct indices for every primitive topology
-		switch (type) {
-			case PrimitiveType::Points: {
-				for (std::size_t i = 0; i < primitiveCount; ++i)
-					indices[i] = static_cast<T>(i);
+	/**
+	 * Collects the data generated for an asset, which is only written into a single new buffer once
+	 * everything has been generated, so that the amount of buffers does not scale with the amount of
+	 * primitives. Every chunk of data is aligned to 4 bytes.
+	 */
+	class GeneratedBuffer {
+		std::size_t bufferIndex;
+		std::size_t byteLength = 0;
+		std::vector<std::pair<std::size_t, StaticVector<std::byte>>> chunks;
+
+	public:
+		explicit GeneratedBuffer(std::size_t bufferIndex) : bufferIndex(bufferIndex) {}
+
+		[[nodiscard]] std::size_t index() const noexcept {
+			return bufferIndex;
+		}
+
+		/** Appends the data to the buffer and returns its byte offset. */
+		std::size_t append(StaticVector<std::byte>&& data) {
+			const auto offset = alignUp(byteLength, 4);
+			byteLength = offset + data.size_bytes();
+			chunks.emplace_back(offset, std::move(data));
+			return offset;
+		}
+
+		/** Adds the buffer to the asset, if any data has been appended. */
+		void finish(Asset& asset) {
+			if (chunks.empty())
+				return;
+
+			StaticVector<std::byte> data(byteLength, std::byte(0));
+			for (auto& [offset, chunk] : chunks) {
+				std::memcpy(data.data() + offset, chunk.data(), chunk.size_bytes());
+				chunk = StaticVector<std::byte>(0);
+			}
+
+			assert(asset.buffers.size() == bufferIndex);
+			auto& buffer = asset.buffers.emplace_back();
+			buffer.byteLength = byteLength;
+			buffer.data = sources::Array {
+				std::move(data),
+				MimeType::GltfBuffer,
+			};
+		}
+	};
+
+	/** Returns the smallest component type used for generated indices referring to vertexCount vertices. */
+	ComponentType getGeneratedIndexComponentType(std::size_t vertexCount) {
+		if (vertexCount < 255) {
+			return ComponentType::UnsignedByte;
+		} else if (vertexCount < 65535) {
+			return ComponentType::UnsignedShort;
+		} else {
+			return ComponentType::UnsignedInt;
+		}
+	}
+
+	/** Reads the i-th index from tightly packed index data of the given component type. */
+	std::uint32_t readIndex(const std::byte* data, ComponentType componentType, std::size_t i) {
+		switch (componentType) {
+			case ComponentType::UnsignedByte:
+				return static_cast<std::uint32_t>(data[i]);
+			case ComponentType::UnsignedShort: {
+				std::uint16_t index;
+				std::memcpy(&index, data + i * sizeof index, sizeof index);
+				return index;
+			}
+			default: {
+				std::uint32_t index;
+				std::memcpy(&index, data + i * sizeof index, sizeof index);
+				return index;
+			}
+		}
+	}
+
+	/** Writes the i-th index into tightly packed index data of the given component type. */
+	void writeIndex(std::byte* data, ComponentType componentType, std::size_t i, std::uint32_t index) {
+		switch (componentType) {
+			case ComponentType::UnsignedByte:
+				data[i] = static_cast<std::byte>(index);
+				break;
+			case ComponentType::UnsignedShort: {
+				const auto value = static_cast<std::uint16_t>(index);
+				std::memcpy(data + i * sizeof value, &value, sizeof value);
 				break;
 			}
-			case PrimitiveType::Lines:
-			case PrimitiveType::LineLoop:
-			case PrimitiveType::LineStrip: {
-				for (std::size_t i = 0; i < primitiveCount; ++i) {
-					indices[i * 2 + 0] = static_cast<T>(i * 2 + 0);
-					indices[i * 2 + 1] = static_cast<T>(i * 2 + 1);
-				}
+			default:
+				std::memcpy(data + i * sizeof index, &index, sizeof index);
 				break;
+		}
+	}
+}
+
+namespace fastgltf {
+	/** Returns the bytes of a buffer view, or an empty span if the data of its buffer is not in memory. */
+	span<const std::byte> getBufferViewBytes(const Asset& asset, std::size_t bufferViewIndex) {
+		if (bufferViewIndex >= asset.bufferViews.size())
+			return {};
+		const auto& bufferView = asset.bufferViews[bufferViewIndex];
+		if (bufferView.meshoptCompression || bufferView.bufferIndex >= asset.buffers.size())
+			return {};
+
+		auto bytes = std::visit(visitor {
+			[](auto&) -> span<const std::byte> {
+				return {};
+			},
+			[](const sources::Array& array) -> span<const std::byte> {
+				return span(array.bytes.data(), array.bytes.size_bytes());
+			},
+			[](const sources::Vector& vec) -> span<const std::byte> {
+				return span(vec.bytes.data(), vec.bytes.size());
+			},
+			[](const sources::ByteView& bv) -> span<const std::byte> {
+				return bv.bytes;
+			},
+		}, asset.buffers[bufferView.bufferIndex].data);
+		if (bytes.data() == nullptr || bufferView.byteOffset + bufferView.byteLength > bytes.size())
+			return {};
+		return bytes.subspan(bufferView.byteOffset, bufferView.byteLength);
+	}
+
+	/**
+	 * Copies the raw bytes of every element of the accessor into dst, with a stride of dstStride,
+	 * after replacing the elements of sparse accessors. Returns false if the data is not available.
+	 */
+	bool copyRawAccessorElements(const Asset& asset, const Accessor& accessor, std::byte* dst, std::size_t dstStride) {
+		const auto elementSize = getElementByteSize(accessor.type, accessor.componentType);
+		if (accessor.bufferViewIndex.has_value()) {
+			const auto bytes = getBufferViewBytes(asset, *accessor.bufferViewIndex);
+			const auto& byteStride = asset.bufferViews[*accessor.bufferViewIndex].byteStride;
+			const auto srcStride = byteStride.has_value() ? *byteStride : elementSize;
+			if (bytes.data() == nullptr || (accessor.count != 0 && accessor.byteOffset + (accessor.count - 1) * srcStride + elementSize > bytes.size()))
+				return false;
+
+			for (std::size_t i = 0; i < accessor.count; ++i) {
+				std::memcpy(dst + i * dstStride, bytes.data() + accessor.byteOffset + i * srcStride, elementSize);
+			}
+		} else {
+			// Accessors without a buffer view are initialized with zeros.
+			for (std::size_t i = 0; i < accessor.count; ++i) {
+				std::memset(dst + i * dstStride, 0, elementSize);
 			}
-			case PrimitiveType::Triangles:
-			case PrimitiveType::TriangleStrip:
-			case PrimitiveType::TriangleFan: {
-				for (std::size_t i = 0; i < primitiveCount; ++i) {
-					indices[i * 3 + 0] = static_cast<T>(i * 3 + 0);
-					indices[i * 3 + 1] = static_cast<T>(i * 3 + 1);
-					indices[i * 3 + 2] = static_cast<T>(i * 3 + 2);
+		}
+
+		if (!accessor.sparse.has_value())
+			return true;
+
+		const auto& sparse = *accessor.sparse;
+		const auto indexSize = getComponentByteSize(sparse.indexComponentType);
+		const auto indices = getBufferViewBytes(asset, sparse.indicesBufferView);
+		const auto values = getBufferViewBytes(asset, sparse.valuesBufferView);
+		if (indices.data() == nullptr || values.data() == nullptr
+				|| sparse.indicesByteOffset + sparse.count * indexSize > indices.size()
+				|| sparse.valuesByteOffset + sparse.count * elementSize > values.size())
+			return false;
+
+		for (std::size_t i = 0; i < sparse.count; ++i) {
+			std::uint32_t index = 0;
+			const auto* indexBytes = indices.data() + sparse.indicesByteOffset + i * indexSize;
+			switch (sparse.indexComponentType) {
+				case ComponentType::UnsignedByte:
+					index = static_cast<std::uint32_t>(*indexBytes);
+					break;
+				case ComponentType::UnsignedShort: {
+					std::uint16_t shortIndex;
+					std::memcpy(&shortIndex, indexBytes, sizeof shortIndex);
+					index = shortIndex;
+					break;
 				}
-				break;
+				case ComponentType::UnsignedInt:
+					std::memcpy(&index, indexBytes, sizeof index);
+					break;
+				default:
+					return false;
 			}
-			default: FASTGLTF_UNREACHABLE
+			if (index >= accessor.count)
+				return false;
+			std::memcpy(dst + index * dstStride, values.data() + sparse.valuesByteOffset + i * elementSize, elementSize);
 		}
+		return true;
 	}
 
-	std::pair<StaticVector<std::byte>, ComponentType> writeIndices(PrimitiveType type, std::size_t indexCount, std::size_t primitiveCount) {
-		if (indexCount < 255) {
-			StaticVector<std::byte> generatedIndices(indexCount * sizeof(std::uint8_t));
-			span<std::uint8_t> indices(reinterpret_cast<std::uint8_t*>(generatedIndices.data()), generatedIndices.size() / sizeof(std::uint8_t));
-			writeIndices(type, indices, primitiveCount);
-			return std::make_pair(generatedIndices, ComponentType::UnsignedByte);
-		} else if (indexCount < 65535) {
-			StaticVector<std::byte> generatedIndices(indexCount * sizeof(std::uint16_t));
-			span<std::uint16_t> indices(reinterpret_cast<std::uint16_t*>(generatedIndices.data()), generatedIndices.size() / sizeof(std::uint16_t));
-			writeIndices(type, indices, primitiveCount);
-			return std::make_pair(generatedIndices, ComponentType::UnsignedShort);
-		} else {
-			StaticVector<std::byte> generatedIndices(indexCount * sizeof(std::uint32_t));
-			span<std::uint32_t> indices(reinterpret_cast<std::uint32_t*>(generatedIndices.data()), generatedIndices.size() / sizeof(std::uint32_t));
-			writeIndices(type, indices, primitiveCount);
-			return std::make_pair(generatedIndices, ComponentType::UnsignedInt);
+	/** All attributes of a primitive, including those of its morph targets, packed into a single vertex. */
+	struct PackedVertices {
+		// Every attribute together with its byte offset in the packed vertex.
+		std::vector<std::pair<Attribute*, std::size_t>> attributes;
+		std::size_t vertexSize = 0;
+		std::size_t vertexCount = 0;
+		StaticVector<std::byte> data = StaticVector<std::byte>(0);
+	};
+
+	/**
+	 * Packs the attributes of the primitive into interleaved vertices. Returns false if some attribute
+	 * does not have vertexCount elements, or if its data is not available.
+	 */
+	bool packVertices(Asset& asset, Primitive& primitive, std::size_t vertexCount, PackedVertices& packed) {
+		auto addAttributes = [&](auto& attributeList) {
+			for (auto& attribute : attributeList) {
+				if (attribute.accessorIndex >= asset.accessors.size())
+					return false;
+				const auto& accessor = asset.accessors[attribute.accessorIndex];
+				if (accessor.count != vertexCount)
+					return false;
+				packed.attributes.emplace_back(&attribute, packed.vertexSize);
+				packed.vertexSize += getElementByteSize(accessor.type, accessor.componentType);
+			}
+			return true;
+		};
+		if (!addAttributes(primitive.attributes))
+			return false;
+		for (auto& target : primitive.targets) {
+			if (!addAttributes(target))
+				return false;
 		}
+
+		packed.vertexCount = vertexCount;
+		packed.data = StaticVector<std::byte>(vertexCount * packed.vertexSize);
+		for (auto& [attribute, offset] : packed.attributes) {
+			if (!copyRawAccessorElements(asset, asset.accessors[attribute->accessorIndex], packed.data.data() + offset, packed.vertexSize))
+				return false;
+		}
+		return true;
 	}
-}
+
+	/**
+	 * Appends the packed vertices listed in order to the generated buffer, with a new buffer view and
+	 * accessor per attribute, and changes the attributes to use them. Because the vertices only ever
+	 * get removed or reordered, the bounds of the original accessors stay the same.
+	 */
+	void writePackedVertices(Asset& asset, const PackedVertices& packed, span<const std::uint32_t> order, GeneratedBuffer& generated) {
+		// Every attribute gets its own buffer view. Its elements are aligned to 4 bytes, as the spec
+		// requires for vertex attributes, which needs a byteStride for elements like i16 VEC3.
+		std::vector<std::size_t> attributeOffsets(packed.attributes.size());
+		std::vector<std::size_t> attributeStrides(packed.attributes.size());
+		std::size_t bufferSize = 0;
+		for (std::size_t a = 0; a < packed.attributes.size(); ++a) {
+			const auto& accessor = asset.accessors[packed.attributes[a].first->accessorIndex];
+			attributeOffsets[a] = bufferSize;
+			attributeStrides[a] = alignUp(getElementByteSize(accessor.type, accessor.componentType), 4);
+			bufferSize += order.size() * attributeStrides[a];
+		}
+
+		StaticVector<std::byte> data(bufferSize, std::byte(0));
+		for (std::size_t a = 0; a < packed.attributes.size(); ++a) {
+			const auto& accessor = asset.accessors[packed.attributes[a].first->accessorIndex];
+			const auto elementSize = getElementByteSize(accessor.type, accessor.componentType);
+			auto* dst = data.data() + attributeOffsets[a];
+			for (std::size_t i = 0; i < order.size(); ++i) {
+				std::memcpy(dst + i * attributeStrides[a], packed.data.data() + order[i] * packed.vertexSize + packed.attributes[a].second, elementSize);
+			}
+		}
+
+		const auto dataOffset = generated.append(std::move(data));
+
+		for (std::size_t a = 0; a < packed.attributes.size(); ++a) {
+			auto* attribute = packed.attributes[a].first;
+			const auto elementSize = getElementByteSize(asset.accessors[attribute->accessorIndex].type,
+				asset.accessors[attribute->accessorIndex].componentType);
+
+			auto bufferViewIdx = asset.bufferViews.size();
+			auto& bufferView = asset.bufferViews.emplace_back();
+			bufferView.bufferIndex = generated.index();
+			bufferView.byteOffset = dataOffset + attributeOffsets[a];
+			bufferView.byteLength = order.size() * attributeStrides[a];
+			if (attributeStrides[a] != elementSize)
+				bufferView.byteStride = attributeStrides[a];
+			bufferView.target = BufferTarget::ArrayBuffer;
+
+			auto accessorIdx = asset.accessors.size();
+			Accessor accessor;
+			const auto& original = asset.accessors[attribute->accessorIndex];
+			accessor.type = original.type;
+			accessor.componentType = original.componentType;
+			accessor.normalized = original.normalized;
+			accessor.min = original.min;
+			accessor.max = original.max;
+			accessor.count = order.size();
+			accessor.bufferViewIndex = bufferViewIdx;
+			asset.accessors.emplace_back(std::move(accessor));
+			attribute->accessorIndex = accessorIdx;
+		}
+	}
+
+	/**
+	 * Deduplicates the vertices of a primitive without indices. All attributes, including those of the
+	 * morph targets, are packed into a single vertex, and identical vertices are found using an
+	 * open-addressing hash table. The unique vertices are then written into the generated buffer.
+	 * Returns the index of the unique vertex for every original vertex, or an empty vector if
+	 * nothing could be deduplicated, or if the data of some attribute is not available.
+	 */
+	std::vector<std::uint32_t> weldVertices(Asset& asset, Primitive& primitive, std::size_t vertexCount, GeneratedBuffer& generated) {
+		if (vertexCount == 0 || vertexCount > std::numeric_limits<std::uint32_t>::max())
+			return {};
+
+		PackedVertices packed;
+		if (!packVertices(asset, primitive, vertexCount, packed))
+			return {};
+		const auto vertexSize = packed.vertexSize;
+
+		// Use a power of two table with a load factor of at most 0.5, so that linear probing stays short.
+		std::size_t tableSize = 16;
+		while (tableSize < vertexCount * 2)
+			tableSize *= 2;
+		constexpr auto emptySlot = std::numeric_limits<std::uint32_t>::max();
+		std::vector<std::uint32_t> table(tableSize, emptySlot);
+
+		std::vector<std::uint32_t> remap(vertexCount);
+		std::vector<std::uint32_t> uniqueVertices;
+		uniqueVertices.reserve(vertexCount);
+		for (std::size_t i = 0; i < vertexCount; ++i) {
+			const auto* vertex = packed.data.data() + i * vertexSize;
+			auto slot = static_cast<std::size_t>(crcStringFunction(std::string_view(reinterpret_cast<const char*>(vertex), vertexSize))) & (tableSize - 1);
+			while (true) {
+				const auto candidate = table[slot];
+				if (candidate == emptySlot) {
+					table[slot] = static_cast<std::uint32_t>(i);
+					remap[i] = static_cast<std::uint32_t>(uniqueVertices.size());
+					uniqueVertices.emplace_back(static_cast<std::uint32_t>(i));
+					break;
+				}
+				if (std::memcmp(packed.data.data() + candidate * vertexSize, vertex, vertexSize) == 0) {
+					remap[i] = remap[candidate];
+					break;
+				}
+				slot = (slot + 1) & (tableSize - 1);
+			}
+		}
+
+		if (uniqueVertices.size() == vertexCount)
+			return {};
+
+		writePackedVertices(asset, packed, span(uniqueVertices.data(), uniqueVertices.size()), generated);
+		return remap;
+	}
+} // namespace fastgltf
 
 fg::Error fg::Parser::generateMeshIndices(fastgltf::Asset& asset) const {
+	GeneratedBuffer generated(asset.buffers.size());
+
+	struct GeneratedIndices {
+		Primitive* primitive;
+		std::size_t indexCount;
+		std::size_t vertexCount;
+		// The index of the unique vertex for every vertex, or empty for the trivial index sequence.
+		std::vector<std::uint32_t> remap;
+	};
+	std::vector<GeneratedIndices> generatedIndices;
+
 	for (auto& mesh : asset.meshes) {
 		for (auto& primitive : mesh.primitives) {
 			if (primitive.indicesAccessor.has_value())
@@ -901,58 +1256,301 @@ fg::Error fg::Parser::generateMeshIndices(fastgltf::Asset& asset) const {
 			}
 			auto positionCount = asset.accessors[positionAttribute->accessorIndex].count;
 
-			auto primitiveCount = [&]() -> std::size_t {
-				switch (primitive.type) {
-					case PrimitiveType::Points: return positionCount;
-					case PrimitiveType::Lines: return positionCount / 2;
-					case PrimitiveType::LineLoop:
-					case PrimitiveType::LineStrip: return max<std::size_t>(0, positionCount - 1);
-					case PrimitiveType::Triangles: return positionCount / 3;
-					case PrimitiveType::TriangleStrip: return max<std::size_t>(0U, positionCount - 2);
-					case PrimitiveType::TriangleFan: return max<std::size_t>(0U, positionCount - 2);
-					default: FASTGLTF_UNREACHABLE
-				}
-			}();
-			auto indexCount = [&]() -> std::size_t {
-				switch (primitive.type) {
-					case PrimitiveType::Points: return primitiveCount;
-					case PrimitiveType::Lines:
-					case PrimitiveType::LineLoop:
-					case PrimitiveType::LineStrip: return primitiveCount * 2;
-					case PrimitiveType::Triangles:
-					case PrimitiveType::TriangleStrip:
-					case PrimitiveType::TriangleFan: return primitiveCount * 3;
-					default: FASTGLTF_UNREACHABLE
+			// The indices are the (remapped) sequence of all vertices, which is valid for every topology.
+			std::vector<std::uint32_t> remap;
+			if (hasBit(options, Options::WeldGeneratedMeshIndices))
+				remap = weldVertices(asset, primitive, positionCount, generated);
+
+			const auto vertexCount = asset.accessors[primitive.findAttribute("POSITION")->accessorIndex].count;
+			generatedIndices.emplace_back(GeneratedIndices { &primitive, positionCount, vertexCount, std::move(remap) });
+		}
+	}
+
+	// The indices of each component type are written into a single buffer view. All primitives with
+	// the trivial sequence share a prefix of the longest sequence at the start of the buffer view,
+	// and the welded indices of each primitive are appended after it.
+	for (auto componentType : { ComponentType::UnsignedByte, ComponentType::UnsignedShort, ComponentType::UnsignedInt }) {
+		std::size_t sequenceCount = 0;
+		std::size_t indexCount = 0;
+		for (auto& indices : generatedIndices) {
+			if (getGeneratedIndexComponentType(indices.vertexCount) != componentType)
+				continue;
+			if (indices.remap.empty()) {
+				sequenceCount = max(sequenceCount, indices.indexCount);
+			} else {
+				indexCount += indices.remap.size();
+			}
+		}
+		indexCount += sequenceCount;
+		if (indexCount == 0)
+			continue;
+
+		const auto componentSize = getComponentByteSize(componentType);
+		StaticVector<std::byte> data(indexCount * componentSize);
+		for (std::size_t i = 0; i < sequenceCount; ++i) {
+			writeIndex(data.data(), componentType, i, static_cast<std::uint32_t>(i));
+		}
+
+		const auto bufferViewIdx = asset.bufferViews.size();
+		auto addAccessor = [&](std::size_t byteOffset, std::size_t count) {
+			auto& accessor = asset.accessors.emplace_back();
+			accessor.byteOffset = byteOffset;
+			accessor.count = count;
+			accessor.type = AccessorType::Scalar;
+			accessor.componentType = componentType;
+			accessor.normalized = false;
+			accessor.bufferViewIndex = bufferViewIdx;
+			return asset.accessors.size() - 1;
+		};
+
+		// Every primitive gets its own accessor, so that changing the indices of one primitive
+		// afterwards does not affect any other primitive.
+		std::size_t offset = sequenceCount;
+		for (auto& indices : generatedIndices) {
+			if (getGeneratedIndexComponentType(indices.vertexCount) != componentType)
+				continue;
+
+			if (indices.remap.empty()) {
+				indices.primitive->indicesAccessor = addAccessor(0, indices.indexCount);
+			} else {
+				for (std::size_t i = 0; i < indices.remap.size(); ++i) {
+					writeIndex(data.data(), componentType, offset + i, indices.remap[i]);
 				}
-			}();
+				indices.primitive->indicesAccessor = addAccessor(offset * componentSize, indices.remap.size());
+				offset += indices.remap.size();
+			}
+		}
 
-			auto [generatedIndices, componentType] = writeIndices(primitive.type, indexCount, primitiveCount);
+		auto& bufferView = asset.bufferViews.emplace_back();
+		bufferView.bufferIndex = generated.index();
+		bufferView.byteLength = data.size_bytes();
+		bufferView.byteOffset = generated.append(std::move(data));
+	}
 
-			auto bufferIdx = asset.buffers.size();
-			auto& buffer = asset.buffers.emplace_back();
-			buffer.byteLength = generatedIndices.size_bytes();
-			sources::Array indicesArray {
-				std::move(generatedIndices),
-				MimeType::GltfBuffer,
+	generated.finish(asset);
+	return Error::None;
+}
+
+void fg::optimizeVertexCache(span<std::uint32_t> indices, std::size_t vertexCount, std::size_t cacheSize) {
+	const auto triangleCount = indices.size() / 3;
+	if (triangleCount == 0 || vertexCount == 0)
+		return;
+
+	// The amount of triangles of every vertex that have not been emitted yet.
+	std::vector<std::uint32_t> liveTriangles(vertexCount, 0);
+	for (std::size_t i = 0; i < triangleCount * 3; ++i) {
+		assert(indices[i] < vertexCount);
+		++liveTriangles[indices[i]];
+	}
+
+	// The triangles adjacent to each vertex, stored contiguously for all vertices.
+	std::vector<std::size_t> adjacencyOffsets(vertexCount + 1, 0);
+	for (std::size_t v = 0; v < vertexCount; ++v) {
+		adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveTriangles[v];
+	}
+	std::vector<std::uint32_t> adjacency(triangleCount * 3);
+	{
+		std::vector<std::size_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for (std::size_t i = 0; i < triangleCount * 3; ++i) {
+			adjacency[fill[indices[i]]++] = static_cast<std::uint32_t>(i / 3);
+		}
+	}
+
+	// Tipsify: emit all remaining triangles around a fanning vertex, and then choose the next fanning
+	// vertex among the vertices just emitted, preferring those which are still going to be in the
+	// simulated FIFO cache after their triangles were emitted.
+	std::vector<std::size_t> cacheTimestamps(vertexCount, 0);
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<std::uint32_t> deadEnds;
+	std::vector<std::uint32_t> candidates;
+	std::vector<std::uint32_t> result;
+	result.reserve(triangleCount * 3);
+
+	constexpr auto noVertex = std::numeric_limits<std::size_t>::max();
+	std::size_t timestamp = cacheSize + 1;
+	std::size_t cursor = 0;
+	std::size_t fanningVertex = 0;
+	while (fanningVertex != noVertex) {
+		candidates.clear();
+		for (auto a = adjacencyOffsets[fanningVertex]; a < adjacencyOffsets[fanningVertex + 1]; ++a) {
+			const auto triangle = adjacency[a];
+			if (emitted[triangle])
+				continue;
+			emitted[triangle] = true;
+
+			for (std::size_t k = 0; k < 3; ++k) {
+				const auto vertex = indices[triangle * 3 + k];
+				result.emplace_back(vertex);
+				deadEnds.emplace_back(vertex);
+				candidates.emplace_back(vertex);
+				--liveTriangles[vertex];
+				if (timestamp - cacheTimestamps[vertex] > cacheSize)
+					cacheTimestamps[vertex] = timestamp++;
+			}
+		}
+
+		fanningVertex = noVertex;
+		std::size_t bestPriority = 0;
+		for (const auto vertex : candidates) {
+			if (liveTriangles[vertex] == 0)
+				continue;
+			std::size_t priority = 1;
+			const auto age = timestamp - cacheTimestamps[vertex];
+			if (age + 2 * liveTriangles[vertex] <= cacheSize)
+				priority += age;
+			if (priority > bestPriority) {
+				bestPriority = priority;
+				fanningVertex = vertex;
+			}
+		}
+
+		// Without any candidates, continue with the most recently used vertex or the next vertex in order.
+		while (fanningVertex == noVertex && !deadEnds.empty()) {
+			const auto vertex = deadEnds.back();
+			deadEnds.pop_back();
+			if (liveTriangles[vertex] != 0)
+				fanningVertex = vertex;
+		}
+		while (fanningVertex == noVertex && cursor < vertexCount) {
+			if (liveTriangles[cursor] != 0)
+				fanningVertex = cursor;
+			++cursor;
+		}
+	}
+
+	std::memcpy(indices.data(), result.data(), result.size() * sizeof(std::uint32_t));
+}
+
+float fg::computeVertexCacheMissRatio(span<const std::uint32_t> indices, std::size_t vertexCount, std::size_t cacheSize) {
+	const auto triangleCount = indices.size() / 3;
+	if (triangleCount == 0)
+		return 0.0f;
+
+	std::vector<std::size_t> cacheTimestamps(vertexCount, 0);
+	std::size_t timestamp = cacheSize + 1;
+	std::size_t misses = 0;
+	for (std::size_t i = 0; i < triangleCount * 3; ++i) {
+		const auto vertex = indices[i];
+		if (vertex >= vertexCount)
+			continue;
+		if (timestamp - cacheTimestamps[vertex] > cacheSize) {
+			cacheTimestamps[vertex] = timestamp++;
+			++misses;
+		}
+	}
+	return static_cast<float>(misses) / static_cast<float>(triangleCount);
+}
+
+fg::Error fg::Parser::optimizeMeshes(fastgltf::Asset& asset) const {
+	GeneratedBuffer generated(asset.buffers.size());
+
+	// Vertices are only reordered when no other primitive uses the same attribute accessors,
+	// as the vertex data would otherwise have to be duplicated.
+	std::vector<std::size_t> accessorUses(asset.accessors.size(), 0);
+	auto countUses = [&](const auto& attributes) {
+		for (const auto& attribute : attributes) {
+			if (attribute.accessorIndex < accessorUses.size())
+				++accessorUses[attribute.accessorIndex];
+		}
+	};
+	for (const auto& mesh : asset.meshes) {
+		for (const auto& primitive : mesh.primitives) {
+			countUses(primitive.attributes);
+			for (const auto& target : primitive.targets)
+				countUses(target);
+		}
+	}
+
+	for (auto& mesh : asset.meshes) {
+		for (auto& primitive : mesh.primitives) {
+			if (primitive.type != PrimitiveType::Triangles || !primitive.indicesAccessor.has_value())
+				continue;
+
+			auto* positionAttribute = primitive.findAttribute("POSITION");
+			if (positionAttribute == primitive.attributes.end() || positionAttribute->accessorIndex >= asset.accessors.size()
+					|| *primitive.indicesAccessor >= asset.accessors.size()) {
+				return Error::InvalidGltf;
+			}
+			const auto vertexCount = asset.accessors[positionAttribute->accessorIndex].count;
+
+			// Primitives whose indices are not in memory or are out of range are left untouched.
+			const auto& indexAccessor = asset.accessors[*primitive.indicesAccessor];
+			const auto componentType = indexAccessor.componentType;
+			if (indexAccessor.type != AccessorType::Scalar || indexAccessor.count < 3 || vertexCount == 0)
+				continue;
+			if (componentType != ComponentType::UnsignedByte && componentType != ComponentType::UnsignedShort
+					&& componentType != ComponentType::UnsignedInt)
+				continue;
+
+			const auto componentSize = getComponentByteSize(componentType);
+			StaticVector<std::byte> indexData(indexAccessor.count * componentSize);
+			if (!copyRawAccessorElements(asset, indexAccessor, indexData.data(), componentSize))
+				continue;
+
+			std::vector<std::uint32_t> indices(indexAccessor.count);
+			bool validIndices = true;
+			for (std::size_t i = 0; i < indices.size(); ++i) {
+				indices[i] = readIndex(indexData.data(), componentType, i);
+				validIndices &= indices[i] < vertexCount;
+			}
+			if (!validIndices)
+				continue;
+
+			optimizeVertexCache(span<std::uint32_t>(indices.data(), indices.size()), vertexCount);
+
+			bool exclusiveAttributes = true;
+			auto checkUses = [&](const auto& attributes) {
+				for (const auto& attribute : attributes)
+					exclusiveAttributes &= attribute.accessorIndex < accessorUses.size() && accessorUses[attribute.accessorIndex] == 1;
 			};
-			buffer.data = std::move(indicesArray);
+			checkUses(primitive.attributes);
+			for (const auto& target : primitive.targets)
+				checkUses(target);
+
+			// Reorder the vertices in the order they are first used by the triangles, so that they
+			// are fetched mostly sequentially. Unused vertices are kept at the end.
+			PackedVertices packed;
+			if (exclusiveAttributes && packVertices(asset, primitive, vertexCount, packed)) {
+				constexpr auto unassigned = std::numeric_limits<std::uint32_t>::max();
+				std::vector<std::uint32_t> remap(vertexCount, unassigned);
+				std::vector<std::uint32_t> order;
+				order.reserve(vertexCount);
+				for (auto& index : indices) {
+					if (remap[index] == unassigned) {
+						remap[index] = static_cast<std::uint32_t>(order.size());
+						order.emplace_back(index);
+					}
+					index = remap[index];
+				}
+				for (std::size_t v = 0; v < vertexCount; ++v) {
+					if (remap[v] == unassigned)
+						order.emplace_back(static_cast<std::uint32_t>(v));
+				}
+				writePackedVertices(asset, packed, span(order.data(), order.size()), generated);
+			}
+
+			for (std::size_t i = 0; i < indices.size(); ++i) {
+				writeIndex(indexData.data(), componentType, i, indices[i]);
+			}
 
 			auto bufferViewIdx = asset.bufferViews.size();
 			auto& bufferView = asset.bufferViews.emplace_back();
-			bufferView.byteLength = buffer.byteLength;
-			bufferView.bufferIndex = bufferIdx;
-			bufferView.byteOffset = 0;
+			bufferView.bufferIndex = generated.index();
+			bufferView.byteLength = indexData.size_bytes();
+			bufferView.byteOffset = generated.append(std::move(indexData));
 
-			primitive.indicesAccessor = asset.accessors.size();
-			auto& accessor = asset.accessors.emplace_back();
-			accessor.byteOffset = 0;
-			accessor.count = positionCount;
+			Accessor accessor;
+			accessor.count = indices.size();
 			accessor.type = AccessorType::Scalar;
 			accessor.componentType = componentType;
 			accessor.normalized = false;
 			accessor.bufferViewIndex = bufferViewIdx;
+			asset.accessors.emplace_back(std::move(accessor));
+			primitive.indicesAccessor = asset.accessors.size() - 1;
 		}
 	}
+
+	generated.finish(asset);
 	return Error::None;
 }
 
@@ -1423,15 +2021,143 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 	return Error::None;
 }
 
-fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category categories) {
+fg::Error fg::decompressMeshoptBufferView(Asset& asset, std::size_t bufferViewIndex) {
+	if (bufferViewIndex >= asset.bufferViews.size())
+		return Error::InvalidGltf;
+
+	auto& bufferView = asset.bufferViews[bufferViewIndex];
+	if (!bufferView.meshoptCompression)
+		return Error::None;
+
+	const auto& compression = *bufferView.meshoptCompression;
+	if (compression.bufferIndex >= asset.buffers.size() || !meshopt::isValidDecodedSize(compression, bufferView.byteLength))
+		return Error::InvalidGltf;
+
+	// The visited variant is not const, so the generic case has to take a const reference as well,
+	// as it would otherwise be a better match than the overloads below.
+	auto source = std::visit(visitor {
+		[](const auto&) -> span<const std::byte> {
+			return {};
+		},
+		[](const sources::Array& array) -> span<const std::byte> {
+			return span(array.bytes.data(), array.bytes.size_bytes());
+		},
+		[](const sources::Vector& vec) -> span<const std::byte> {
+			return span(vec.bytes.data(), vec.bytes.size());
+		},
+		[](const sources::ByteView& bv) -> span<const std::byte> {
+			return bv.bytes;
+		},
+	}, asset.buffers[compression.bufferIndex].data);
+	if (source.data() == nullptr || compression.byteOffset > source.size() || compression.byteLength > source.size() - compression.byteOffset)
+		return Error::InvalidCompressedData;
+	source = source.subspan(compression.byteOffset, compression.byteLength);
+
+	StaticVector<std::byte> decompressed(compression.count * compression.byteStride);
+	if (!meshopt::decode(compression, source, decompressed.data()))
+		return Error::InvalidCompressedData;
+
+	auto bufferIdx = asset.buffers.size();
+	auto& buffer = asset.buffers.emplace_back();
+	buffer.byteLength = decompressed.size_bytes();
+	buffer.data = sources::Array {
+		std::move(decompressed),
+		MimeType::GltfBuffer,
+	};
+
+	// The buffer view now refers to the decompressed data, which the accessors expect.
+	bufferView.bufferIndex = bufferIdx;
+	bufferView.byteOffset = 0;
+	bufferView.byteLength = buffer.byteLength;
+	bufferView.meshoptCompression.reset();
+	return Error::None;
+}
+
+bool fg::Parser::deferExternalFiles() const noexcept {
+	return config.parallelTaskCallback != nullptr || hasBit(options, Options::BatchExternalFileReads);
+}
+
+fg::Error fg::Parser::loadExternalFiles(Asset& asset, Category categories) const {
+	// Collect all buffers and images that still reference a local file, but are supposed to be loaded.
+	// The empty URI of a buffer deferred with Options::DeferGLBBuffer refers to the GLB itself, and is skipped.
+	std::vector<ExternalFile> files;
+	auto collectFiles = [&files](auto& objects) {
+		for (auto& object : objects) {
+			if (auto* uri = std::get_if<sources::URI>(&object.data); uri != nullptr && uri->uri.isLocalPath() && !uri->uri.path().empty()) {
+				files.push_back({ &object.data, uri->mimeType });
+			}
+		}
+	};
+	if (hasBit(options, Options::LoadExternalBuffers) && hasBit(categories, Category::Buffers))
+		collectFiles(asset.buffers);
+	if (hasBit(options, Options::LoadExternalImages) && hasBit(categories, Category::Images))
+		collectFiles(asset.images);
+
+	if (files.empty())
+		return Error::None;
+
+	struct TaskData {
+		const Parser* parser;
+		ExternalFile* files;
+	} taskData { this, files.data() };
+
+	auto loadFile = [](std::size_t fileIndex, void* userData) {
+		auto& data = *static_cast<TaskData*>(userData);
+		auto& file = data.files[fileIndex];
+
+		URIView uriView = std::get<sources::URI>(*file.data).uri;
+		auto [error, source] = data.parser->loadFileFromUri(uriView);
+		if (error != Error::None) {
+			file.error = error;
+			return;
+		}
+		*file.data = std::move(source);
+	};
+
+#if defined(FASTGLTF_HAS_IO_URING)
+	// Mapping files does not read anything, so there is nothing to batch.
+	if (hasBit(options, Options::BatchExternalFileReads) && !hasBit(options, Options::MapExternalFiles)) {
+		readExternalFiles(span<ExternalFile>(files.data(), files.size()));
+	} else
+#endif
+	if (config.parallelTaskCallback != nullptr) {
+		config.parallelTaskCallback(files.size(), loadFile, &taskData, config.userPointer);
+	} else {
+		for (std::size_t i = 0; i < files.size(); ++i) {
+			loadFile(i, &taskData);
+		}
+	}
+
+	// Report the error of the first file in order, independent of how the files were read.
+	for (auto& file : files) {
+		if (file.error != Error::None)
+			return file.error;
+
+		// Keep the mime type that was specified for images.
+		std::visit([mimeType = file.mimeType](auto& arg) {
+			using T = std::decay_t<decltype(arg)>;
+			if constexpr (is_any<T, sources::CustomBuffer, sources::Array, sources::ByteView>()) {
+				arg.mimeType = mimeType;
+			}
+		}, *file.data);
+	}
+	return Error::None;
+}
+
+fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category categories, Category skippedCategories) {
 	using namespace simdjson;
 	fillCategories(categories);
 
 	Asset asset {};
 
 #if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
-	// Create a new chunk memory resource for each asset we parse.
-	asset.memoryResource = resourceAllocator = std::make_shared<std::pmr::monotonic_buffer_resource>();
+	// Every asset gets its own arena, which might have been used by an asset that has been destroyed since.
+	resourceAllocator.reset();
+	asset.memoryResource = resourceAllocator = acquireMemoryResource(memoryResourceSizeHint);
+#endif
+
+#if defined(FASTGLTF_HAS_MEMORY_MAPPED_FILE)
+	resetMappedFiles();
 #endif
 
 	if (!hasBit(options, Options::DontRequireValidAssetMember)) {
@@ -1497,13 +2223,53 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 		}
 	}
 
+	// When a parallel task callback is set, the category arrays are only collected here and are
+	// then parsed all at once after this loop, each by a separate task.
+	struct DeferredCategory {
+		Error (Parser::*parseFunction)(simdjson::dom::array&, Asset&);
+		Category category;
+		dom::array array;
+		// The position of the category within the root object, to report errors in document order.
+		std::size_t position;
+		Error error = Error::None;
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+		std::shared_ptr<ChunkMemoryResource> memoryResource = nullptr;
+#endif
+	};
+	std::vector<DeferredCategory> deferredCategories;
+	const bool deferCategories = config.parallelTaskCallback != nullptr;
+	bool hasDuplicateCategories = false;
+
+	// The external files of buffers and images are only loaded after all categories were parsed. If a
+	// category fails to parse, the files of the categories before it are still loaded, so that the
+	// first error in document order is reported, just like when the files are loaded while parsing.
+	Error rootError = Error::None;
+	std::size_t position = 0;
+	std::size_t buffersPosition = std::numeric_limits<std::size_t>::max();
+	std::size_t imagesPosition = std::numeric_limits<std::size_t>::max();
+	auto firstErrorInDocumentOrder = [&](Error error, std::size_t errorPosition) {
+		if (!deferExternalFiles())
+			return error;
+		Category fileCategories = Category::None;
+		if (buffersPosition <= errorPosition)
+			fileCategories |= Category::Buffers;
+		if (imagesPosition <= errorPosition)
+			fileCategories |= Category::Images;
+		if (fileCategories == Category::None)
+			return error;
+		auto fileError = loadExternalFiles(asset, fileCategories);
+		return fileError != Error::None ? fileError : error;
+	};
+
 	Category readCategories = Category::None;
 	for (const auto object : root) {
+		++position;
 		auto hashedKey = crcStringFunction(object.key);
 		if (hashedKey == force_consteval<crc32c("scene")>) {
 			std::uint64_t defaultScene;
 			if (object.value.get_uint64().get(defaultScene) != SUCCESS) FASTGLTF_UNLIKELY {
-				return Error::InvalidGltf;
+				rootError = Error::InvalidGltf;
+				break;
 			}
 			asset.defaultScene = static_cast<std::size_t>(defaultScene);
 			continue;
@@ -1512,11 +2278,14 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 		if (hashedKey == force_consteval<crc32c("extensions")>) {
 			dom::object extensionsObject;
 			if (object.value.get_object().get(extensionsObject) != SUCCESS) FASTGLTF_UNLIKELY {
-				return Error::InvalidGltf;
+				rootError = Error::InvalidGltf;
+				break;
 			}
 
-			if (auto error = parseExtensions(extensionsObject, asset); error != Error::None)
-				return error;
+			if (auto error = parseExtensions(extensionsObject, asset); error != Error::None) {
+				rootError = error;
+				break;
+			}
 			continue;
 		}
 
@@ -1526,15 +2295,29 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 
 		dom::array array;
 		if (object.value.get_array().get(array) != SUCCESS) FASTGLTF_UNLIKELY {
-			return Error::InvalidGltf;
+			rootError = Error::InvalidGltf;
+			break;
 		}
 
 #define KEY_SWITCH_CASE(name, id) case force_consteval<crc32c(FASTGLTF_QUOTE(id))>:       \
-                if (hasBit(categories, Category::name))   \
-                    error = parse##name(array, asset);                     \
+                if (hasBit(categories, Category::name)) {                   \
+                    if (deferCategories) {                                  \
+                        hasDuplicateCategories |= hasBit(readCategories, Category::name); \
+                        deferredCategories.push_back({ &Parser::parse##name, Category::name, array, position }); \
+                    } else {                                                \
+                        FASTGLTF_IF_STATISTICS(StatisticsScope statisticsScope(statistics[Category::name], FASTGLTF_PARSER_MEMORY_RESOURCE(*this));) \
+                        error = parse##name(array, asset);                  \
+                    }                                                       \
+                }                                                           \
                 readCategories |= Category::name;         \
                 break;
 
+		if (hashedKey == force_consteval<crc32c("buffers")>) {
+			buffersPosition = std::min(buffersPosition, position);
+		} else if (hashedKey == force_consteval<crc32c("images")>) {
+			imagesPosition = std::min(imagesPosition, position);
+		}
+
 		Error error = Error::None;
 		switch (hashedKey) {
 			KEY_SWITCH_CASE(Accessors, accessors)
@@ -1570,13 +2353,102 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 				break;
 		}
 
-		if (error != Error::None)
-			return error;
-
 #undef KEY_SWITCH_CASE
+
+		if (error != Error::None) {
+			rootError = error;
+			break;
+		}
+	}
+
+	if (!deferredCategories.empty()) {
+		struct TaskData {
+			Parser* parser;
+			Asset* asset;
+			DeferredCategory* categories;
+		} taskData { this, &asset, deferredCategories.data() };
+
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+		// The arenas are acquired up front, as the pool of this parser is not thread-safe.
+		for (auto& deferred : deferredCategories) {
+			deferred.memoryResource = acquireMemoryResource(0);
+		}
+#endif
+
+		// Every task parses into its own category of the asset, using a task context that shares the
+		// configuration of this parser, but has its own memory arena. Only the buffers task may take the GLB buffer.
+		auto runTask = [](std::size_t taskIndex, void* userData) {
+			auto& data = *static_cast<TaskData*>(userData);
+			auto& deferred = data.categories[taskIndex];
+
+			Parser worker(*data.parser, TaskContext {});
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+			worker.resourceAllocator = deferred.memoryResource;
+#endif
+			if (deferred.category == Category::Buffers) {
+				worker.glbBuffer = std::move(data.parser->glbBuffer);
+				worker.glbBufferStorage = std::move(data.parser->glbBufferStorage);
+			}
+
+			{
+				FASTGLTF_IF_STATISTICS(StatisticsScope statisticsScope(worker.statistics[deferred.category], FASTGLTF_PARSER_MEMORY_RESOURCE(worker));)
+				deferred.error = (worker.*deferred.parseFunction)(deferred.array, *data.asset);
+			}
+			// Every task writes to a different category, so this does not race with the other tasks.
+			FASTGLTF_IF_STATISTICS(data.parser->statistics[deferred.category] = worker.statistics[deferred.category];)
+		};
+
+		// Categories which appear multiple times would write to the same vector, which is why
+		// we fall back to parsing them serially, in order.
+		if (hasDuplicateCategories || deferredCategories.size() == 1) {
+			for (std::size_t i = 0; i < deferredCategories.size(); ++i) {
+				runTask(i, &taskData);
+				if (deferredCategories[i].error != Error::None)
+					break;
+			}
+		} else {
+			config.parallelTaskCallback(deferredCategories.size(), runTask, &taskData, config.userPointer);
+		}
+
+		// Report the error of the first category in document order, as the serial path would.
+		for (auto& deferred : deferredCategories) {
+			if (deferred.error != Error::None) {
+				return firstErrorInDocumentOrder(deferred.error, deferred.position);
+			}
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+			if (deferred.memoryResource) {
+				asset.taskMemoryResources.emplace_back(std::move(deferred.memoryResource));
+			}
+#endif
+		}
 	}
 
-	asset.availableCategories = readCategories;
+	if (rootError != Error::None) {
+		// The loop stopped at the failing key, so its position is the current one.
+		return firstErrorInDocumentOrder(rootError, position);
+	}
+
+	if (deferExternalFiles()) {
+		FASTGLTF_IF_STATISTICS(CategoryStatistics externalFileStatistics;)
+		{
+			FASTGLTF_IF_STATISTICS(StatisticsScope statisticsScope(externalFileStatistics, nullptr);)
+			if (auto error = loadExternalFiles(asset, Category::Buffers | Category::Images); error != Error::None) {
+				return error;
+			}
+		}
+		FASTGLTF_IF_STATISTICS(statistics.externalFilesDuration = externalFileStatistics.duration;)
+	}
+
+	// The categories pruned from the document by Options::OnDemandParsing were still present in it.
+	asset.availableCategories = readCategories | skippedCategories;
+
+	if (hasBit(options, Options::DecompressMeshoptBuffers)) {
+		for (std::size_t i = 0; i < asset.bufferViews.size(); ++i) {
+			if (auto error = decompressMeshoptBufferView(asset, i); error != Error::None) {
+				return error;
+			}
+		}
+	}
 
 	if (hasBit(options, Options::GenerateMeshIndices)) {
 		if (auto error = generateMeshIndices(asset); error != Error::None) {
@@ -1584,6 +2456,12 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 		}
 	}
 
+	if (hasBit(options, Options::OptimizeMeshes)) {
+		if (auto error = optimizeMeshes(asset); error != Error::None) {
+			return error;
+		}
+	}
+
 	// Resize primitive mappings to match the global variant count
 	if (hasBit(config.extensions, Extensions::KHR_materials_variants) && !asset.materialVariants.empty()) {
 		const auto variantCount = asset.materialVariants.size();
@@ -1596,6 +2474,46 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 		}
 	}
 
+#if defined(FASTGLTF_HAS_MEMORY_MAPPED_FILE)
+	moveMappedFiles(asset);
+#endif
+
+#if FASTGLTF_ENABLE_STATISTICS
+	// The vector of every category is only allocated once, as each parse function reserves it up front.
+	auto countVector = [this](Category category, const auto& vector) {
+		using T = typename std::decay_t<decltype(vector)>::value_type;
+		if (vector.capacity() != 0) {
+			++statistics[category].allocationCount;
+			statistics[category].allocatedBytes += vector.capacity() * sizeof(T);
+		}
+	};
+	countVector(Category::Accessors, asset.accessors);
+	countVector(Category::Animations, asset.animations);
+	countVector(Category::Buffers, asset.buffers);
+	countVector(Category::BufferViews, asset.bufferViews);
+	countVector(Category::Cameras, asset.cameras);
+	countVector(Category::Images, asset.images);
+	countVector(Category::Materials, asset.materials);
+	countVector(Category::Meshes, asset.meshes);
+	countVector(Category::Nodes, asset.nodes);
+	countVector(Category::Samplers, asset.samplers);
+	countVector(Category::Scenes, asset.scenes);
+	countVector(Category::Skins, asset.skins);
+	countVector(Category::Textures, asset.textures);
+
+	// Data which was decoded or loaded into a StaticVector.
+	auto countSources = [this](Category category, const auto& objects) {
+		for (const auto& object : objects) {
+			if (const auto* array = std::get_if<sources::Array>(&object.data); array != nullptr) {
+				++statistics[category].allocationCount;
+				statistics[category].allocatedBytes += array->bytes.size_bytes();
+			}
+		}
+	};
+	countSources(Category::Buffers, asset.buffers);
+	countSources(Category::Images, asset.images);
+#endif
+
 	return std::move(asset);
 }
 
@@ -1988,7 +2906,8 @@ fg::Error fg::Parser::parseBuffers(simdjson::dom::array& buffers, Asset& asset)
                 }
 
                 buffer.data = std::move(source);
-            } else if (uriView.isLocalPath() && hasBit(options, Options::LoadExternalBuffers)) {
+            } else if (uriView.isLocalPath() && hasBit(options, Options::LoadExternalBuffers) && !deferExternalFiles()) {
+				// With a parallel task callback, the file is only loaded after parsing, see loadExternalFiles.
 	            auto [error, source] = loadFileFromUri(uriView);
                 if (error != Error::None) {
                     return error;
@@ -2003,6 +2922,9 @@ fg::Error fg::Parser::parseBuffers(simdjson::dom::array& buffers, Asset& asset)
             }
         } else if (bufferIndex == 0 && !std::holds_alternative<std::monostate>(glbBuffer)) {
             buffer.data = std::move(glbBuffer);
+			if (glbBufferStorage) {
+				asset.sharedStorage.emplace_back(std::move(glbBufferStorage));
+			}
         } else if (meshoptCompressionRequired) {
 			// This buffer is not a GLB buffer and has no URI source and is therefore a fallback.
 			buffer.data = sources::Fallback();
@@ -2378,7 +3300,8 @@ fg::Error fg::Parser::parseImages(simdjson::dom::array& images, Asset& asset) {
                 }
 
                 image.data = std::move(source);
-            } else if (uriView.isLocalPath() && hasBit(options, Options::LoadExternalImages)) {
+            } else if (uriView.isLocalPath() && hasBit(options, Options::LoadExternalImages) && !deferExternalFiles()) {
+				// With a parallel task callback, the file is only loaded after parsing, see loadExternalFiles.
 	            auto [error, source] = loadFileFromUri(uriView);
                 if (error != Error::None) {
                     return error;
@@ -2398,7 +3321,7 @@ fg::Error fg::Parser::parseImages(simdjson::dom::array& images, Asset& asset) {
                     using T = std::decay_t<decltype(arg)>;
 
                     // This is kinda cursed
-                    if constexpr (is_any<T, sources::CustomBuffer, sources::BufferView, sources::URI, sources::Array, sources::Vector>()) {
+                    if constexpr (is_any<T, sources::CustomBuffer, sources::BufferView, sources::URI, sources::Array, sources::Vector, sources::ByteView>()) {
                         arg.mimeType = getMimeTypeFromString(mimeType);
                     }
                 }, image.data);
@@ -3864,6 +4787,115 @@ fg::Error fg::Parser::parseTextures(simdjson::dom::array& textures, Asset& asset
 
 #pragma endregion
 
+#pragma region ChunkMemoryResource
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+void fg::ChunkMemoryResource::reserve(std::size_t bytes) {
+	const auto currentCapacity = capacity();
+	if (currentCapacity >= bytes)
+		return;
+
+	const auto size = std::max(bytes - currentCapacity, initialBlockSize);
+	blocks.push_back({ std::unique_ptr<std::byte[]>(new std::byte[size]), size });
+}
+
+void fg::ChunkMemoryResource::reset() noexcept {
+	blockIdx = 0;
+	blockOffset = 0;
+}
+
+std::size_t fg::ChunkMemoryResource::capacity() const noexcept {
+	std::size_t total = 0;
+	for (const auto& block : blocks)
+		total += block.size;
+	return total;
+}
+
+void* fg::ChunkMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+	// Use the remaining space of the current block, or move on to the next block which fits.
+	for (; blockIdx < blocks.size(); ++blockIdx, blockOffset = 0) {
+		auto& block = blocks[blockIdx];
+		void* ptr = block.data.get() + blockOffset;
+		auto space = block.size - blockOffset;
+		if (std::align(alignment, bytes, ptr, space) != nullptr) {
+			blockOffset = block.size - space + bytes;
+			FASTGLTF_IF_STATISTICS(++allocations; allocatedSize += bytes;)
+			return ptr;
+		}
+	}
+
+	// Allocate a new block, which is twice as large as the last one allocated here, and big enough for this allocation.
+	const auto size = std::max(nextBlockSize, bytes + alignment);
+	nextBlockSize = std::min(nextBlockSize * 2, maxBlockSize);
+	auto& block = blocks.emplace_back(Block { std::unique_ptr<std::byte[]>(new std::byte[size]), size });
+	blockIdx = blocks.size() - 1;
+
+	void* ptr = block.data.get();
+	auto space = block.size;
+	std::align(alignment, bytes, ptr, space);
+	blockOffset = block.size - space + bytes;
+	FASTGLTF_IF_STATISTICS(++allocations; allocatedSize += bytes;)
+	return ptr;
+}
+
+void fg::ChunkMemoryResource::do_deallocate([[maybe_unused]] void* p, [[maybe_unused]] std::size_t bytes, [[maybe_unused]] std::size_t alignment) {
+	// Memory is only ever released all at once.
+}
+
+bool fg::ChunkMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+	return this == &other;
+}
+
+struct fg::Parser::MemoryResourcePool {
+	// Assets might be destroyed on any thread, which is why the pool is guarded by a mutex.
+	std::mutex mutex;
+	std::vector<std::unique_ptr<ChunkMemoryResource>> freeResources;
+};
+
+std::shared_ptr<fg::ChunkMemoryResource> fg::Parser::acquireMemoryResource(std::size_t sizeHint) {
+	if (memoryResourcePool == nullptr) {
+		memoryResourcePool = std::make_shared<MemoryResourcePool>();
+	}
+
+	// Prefer the largest arena whose asset has been destroyed already.
+	std::unique_ptr<ChunkMemoryResource> resource;
+	{
+		std::lock_guard lock(memoryResourcePool->mutex);
+		auto& freeResources = memoryResourcePool->freeResources;
+		auto largest = std::max_element(freeResources.begin(), freeResources.end(), [](auto& a, auto& b) {
+			return a->capacity() < b->capacity();
+		});
+		if (largest != freeResources.end()) {
+			resource = std::move(*largest);
+			freeResources.erase(largest);
+		}
+	}
+	if (resource == nullptr) {
+		resource = std::make_unique<ChunkMemoryResource>();
+	}
+	resource->reset();
+	resource->reserve(sizeHint);
+
+	// Once the last reference is gone, the arena goes back into the pool. If the parser, and with
+	// it the pool, has been destroyed in the meantime, the arena is simply freed.
+	return std::shared_ptr<ChunkMemoryResource>(resource.release(), [pool = std::weak_ptr(memoryResourcePool)](ChunkMemoryResource* released) {
+		std::unique_ptr<ChunkMemoryResource> owned(released);
+		if (auto lockedPool = pool.lock()) {
+			std::lock_guard lock(lockedPool->mutex);
+			lockedPool->freeResources.emplace_back(std::move(owned));
+		}
+	});
+}
+
+void fg::Parser::releaseUnusedMemoryResources() {
+	// Arenas which were not needed for the last load are freed, so that they don't accumulate.
+	if (memoryResourcePool != nullptr) {
+		std::lock_guard lock(memoryResourcePool->mutex);
+		memoryResourcePool->freeResources.clear();
+	}
+}
+#endif
+#pragma endregion
+
 #pragma region Parser
 fastgltf::GltfType fg::determineGltfFileType(GltfDataGetter& data) {
 	// We'll try and read a BinaryGltfHeader from the buffer to see if the magic is correct.
@@ -3893,11 +4925,28 @@ fg::Parser::Parser(Extensions extensionsToLoad) noexcept {
     config.extensions = extensionsToLoad;
 }
 
-fg::Parser::Parser(Parser&& other) noexcept : jsonParser(std::move(other.jsonParser)), config(other.config) {}
+fg::Parser::Parser(const Parser& parent, TaskContext) noexcept
+		: config(parent.config), directory(parent.directory), options(parent.options) {
+#if defined(FASTGLTF_HAS_MEMORY_MAPPED_FILE)
+	mappedFiles = parent.mappedFiles;
+#endif
+}
+
+fg::Parser::Parser(Parser&& other) noexcept : jsonParser(std::move(other.jsonParser)), onDemandParser(std::move(other.onDemandParser)), config(other.config) {
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+	memoryResourcePool = std::move(other.memoryResourcePool);
+	memoryResourceSizeHint = other.memoryResourceSizeHint;
+#endif
+}
 
 fg::Parser& fg::Parser::operator=(Parser&& other) noexcept {
     jsonParser = std::move(other.jsonParser);
+    onDemandParser = std::move(other.onDemandParser);
     config = other.config;
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+	memoryResourcePool = std::move(other.memoryResourcePool);
+	memoryResourceSizeHint = other.memoryResourceSizeHint;
+#endif
     return *this;
 }
 
@@ -3917,9 +4966,109 @@ fg::Expected<fg::Asset> fg::Parser::loadGltf(GltfDataGetter& data, fs::path _dir
     return Error::InvalidFileData;
 }
 
+struct fg::Parser::OnDemandParser {
+	simdjson::ondemand::parser parser;
+	// A padded copy of the input, for data getters which do not return the padding that On-Demand requires.
+	std::string input;
+	// The pruned JSON document, which is kept to reuse its allocation.
+	std::string json;
+};
+
+fg::Error fg::Parser::parseJson(span<std::byte> json, std::size_t length, Category categories, simdjson::dom::object& root, Category& skippedCategories) {
+	using namespace simdjson;
+
+	FASTGLTF_IF_STATISTICS(const auto start = std::chrono::steady_clock::now();)
+	padded_string_view view(reinterpret_cast<const char*>(json.data()), length, json.size());
+
+	skippedCategories = Category::None;
+	fillCategories(categories);
+	if (hasBit(options, Options::OnDemandParsing) && (categories & Category::All) != Category::All) {
+		if (onDemandParser == nullptr) {
+			onDemandParser = std::make_unique<OnDemandParser>();
+		}
+
+		// Lazily walk the root object and copy every field into a new document, except for arrays
+		// of categories which were not requested. These are skipped without being parsed.
+		static constexpr std::array<std::pair<std::string_view, Category>, 13> categoryKeys = {{
+			{ "accessors", Category::Accessors },
+			{ "animations", Category::Animations },
+			{ "buffers", Category::Buffers },
+			{ "bufferViews", Category::BufferViews },
+			{ "cameras", Category::Cameras },
+			{ "images", Category::Images },
+			{ "materials", Category::Materials },
+			{ "meshes", Category::Meshes },
+			{ "nodes", Category::Nodes },
+			{ "samplers", Category::Samplers },
+			{ "scenes", Category::Scenes },
+			{ "skins", Category::Skins },
+			{ "textures", Category::Textures },
+		}};
+
+		// Unlike the DOM parser, the On-Demand parser does not copy the input if it is not padded.
+		padded_string_view inputView = view;
+		if (view.padding() < SIMDJSON_PADDING) {
+			auto& input = onDemandParser->input;
+			input.assign(view.data(), view.length());
+			input.append(SIMDJSON_PADDING, '\0');
+			inputView = padded_string_view(input.data(), view.length(), input.size());
+		}
+
+		ondemand::document document;
+		ondemand::object object;
+		if (onDemandParser->parser.iterate(inputView).get(document) != SUCCESS || document.get_object().get(object) != SUCCESS) FASTGLTF_UNLIKELY {
+			return Error::InvalidJson;
+		}
+
+		auto& pruned = onDemandParser->json;
+		pruned.clear();
+		pruned += '{';
+		for (auto field : object) {
+			std::string_view key;
+			ondemand::value value;
+			ondemand::json_type type;
+			if (field.escaped_key().get(key) != SUCCESS || field.value().get(value) != SUCCESS || value.type().get(type) != SUCCESS) FASTGLTF_UNLIKELY {
+				return Error::InvalidJson;
+			}
+
+			if (type == ondemand::json_type::array) {
+				auto it = std::find_if(categoryKeys.begin(), categoryKeys.end(), [key](auto& pair) { return pair.first == key; });
+				if (it != categoryKeys.end() && !hasBit(categories, it->second)) {
+					skippedCategories |= it->second;
+					continue;
+				}
+			}
+
+			std::string_view rawValue;
+			if (value.raw_json().get(rawValue) != SUCCESS) FASTGLTF_UNLIKELY {
+				return Error::InvalidJson;
+			}
+			if (pruned.size() > 1)
+				pruned += ',';
+			pruned += '"';
+			pruned += key;
+			pruned += "\":";
+			pruned += rawValue;
+		}
+		pruned += '}';
+
+		const auto prunedLength = pruned.size();
+		pruned.append(SIMDJSON_PADDING, '\0');
+		view = padded_string_view(pruned.data(), prunedLength, pruned.size());
+	}
+
+	if (jsonParser->parse(view).get(root) != SUCCESS) FASTGLTF_UNLIKELY {
+		return Error::InvalidJson;
+	}
+	FASTGLTF_IF_STATISTICS(statistics.jsonDuration += std::chrono::steady_clock::now() - start;)
+	return Error::None;
+}
+
 fg::Expected<fg::Asset> fg::Parser::loadGltfJson(GltfDataGetter& data, fs::path _directory, Options _options, Category categories) {
     using namespace simdjson;
 
+	FASTGLTF_IF_STATISTICS(statistics = {};)
+
 	options = _options;
 	directory = std::move(_directory);
 
@@ -3932,22 +5081,31 @@ fg::Expected<fg::Asset> fg::Parser::loadGltfJson(GltfDataGetter& data, fs::path
 
 	data.reset();
 	auto jsonSpan = data.read(data.totalSize(), SIMDJSON_PADDING);
-	padded_string_view view(reinterpret_cast<const std::uint8_t*>(jsonSpan.data()),
-									  data.totalSize(),
-									  data.totalSize() + SIMDJSON_PADDING);
+	if (auto error = data.readError(); error != Error::None) FASTGLTF_UNLIKELY {
+		return error;
+	}
 	dom::object root;
-    if (auto error = jsonParser->parse(view).get(root); error != SUCCESS) FASTGLTF_UNLIKELY {
-	    return Error::InvalidJson;
-    }
+	Category skippedCategories;
+	if (auto error = parseJson(jsonSpan, data.totalSize(), categories, root, skippedCategories); error != Error::None) FASTGLTF_UNLIKELY {
+		return error;
+	}
 
-	return parse(root, categories);
+	auto asset = parse(root, categories, skippedCategories);
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+	releaseUnusedMemoryResources();
+#endif
+	return asset;
 }
 
 fg::Expected<fg::Asset> fg::Parser::loadGltfBinary(GltfDataGetter& data, fs::path _directory, Options _options, Category categories) {
     using namespace simdjson;
 
+	FASTGLTF_IF_STATISTICS(statistics = {};)
+
 	options = _options;
 	directory = std::move(_directory);
+	glbBuffer = std::monostate {};
+	glbBufferStorage.reset();
 
     // If we never have to load the files ourselves, we're fine with the directory being invalid/blank.
     if (std::error_code ec; hasBit(options, Options::LoadExternalBuffers) && (!fs::is_directory(directory, ec) || ec)) {
@@ -3975,17 +5133,17 @@ fg::Expected<fg::Asset> fg::Parser::loadGltfBinary(GltfDataGetter& data, fs::pat
 	    return Error::InvalidGLB;
     }
 
-    // Create a string view of the JSON chunk in the GLB data buffer. The documentation of parse()
-    // says the padding can be initialised to anything, apparently. Therefore, this should work.
+    // Read the JSON chunk from the GLB data buffer. The documentation of parse() says the padding
+    // can be initialised to anything, apparently. Therefore, this should work.
 	auto jsonSpan = data.read(jsonChunk.chunkLength, SIMDJSON_PADDING);
-    simdjson::padded_string_view jsonChunkView(reinterpret_cast<const std::uint8_t*>(jsonSpan.data()),
-                                               jsonChunk.chunkLength,
-                                               jsonChunk.chunkLength + SIMDJSON_PADDING);
-
+	if (auto error = data.readError(); error != Error::None) FASTGLTF_UNLIKELY {
+		return error;
+	}
 	simdjson::dom::object root;
-    if (jsonParser->parse(jsonChunkView).get(root) != SUCCESS) FASTGLTF_UNLIKELY {
-	    return Error::InvalidJson;
-    }
+	Category skippedCategories;
+	if (auto error = parseJson(jsonSpan, jsonChunk.chunkLength, categories, root, skippedCategories); error != Error::None) FASTGLTF_UNLIKELY {
+		return error;
+	}
 
     // Is there enough room for another chunk header?
     if (header.length > (data.bytesRead() + sizeof(BinaryGltfChunk))) {
@@ -3995,9 +5153,24 @@ fg::Expected<fg::Asset> fg::Parser::loadGltfBinary(GltfDataGetter& data, fs::pat
 	        return Error::InvalidGLB;
         }
 
-		// TODO: Somehow allow skipping the binary part in the future?
 		if (binaryChunk.chunkLength != 0) {
-			if (config.mapCallback != nullptr) {
+			auto sharedStorage = hasBit(options, Options::MapGLBBuffer) ? data.getSharedStorage() : nullptr;
+			if (hasBit(options, Options::DeferGLBBuffer)) {
+				// Only record where the BIN chunk is located, and skip over it without reading it.
+				sources::URI filePath;
+				filePath.fileByteOffset = data.bytesRead();
+				filePath.mimeType = MimeType::GltfBuffer;
+				glbBuffer = std::move(filePath);
+				data.skip(binaryChunk.chunkLength);
+			} else if (sharedStorage != nullptr) {
+				// The data getter lets us reference its memory directly, so we avoid copying the buffer.
+				auto bytes = data.read(binaryChunk.chunkLength, 0);
+				glbBuffer = sources::ByteView {
+					span<const std::byte>(bytes.data(), bytes.size()),
+					MimeType::GltfBuffer,
+				};
+				glbBufferStorage = std::move(sharedStorage);
+			} else if (config.mapCallback != nullptr) {
 				auto info = config.mapCallback(binaryChunk.chunkLength, config.userPointer);
 				if (info.mappedMemory != nullptr) {
 					data.read(info.mappedMemory, binaryChunk.chunkLength);
@@ -4016,10 +5189,18 @@ fg::Expected<fg::Asset> fg::Parser::loadGltfBinary(GltfDataGetter& data, fs::pat
 				};
 				glbBuffer = std::move(vectorData);
 			}
+
+			if (auto error = data.readError(); error != Error::None) FASTGLTF_UNLIKELY {
+				return error;
+			}
 		}
     }
 
-	return parse(root, categories);
+	auto asset = parse(root, categories, skippedCategories);
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+	releaseUnusedMemoryResources();
+#endif
+	return asset;
 }
 
 void fg::Parser::setBufferAllocationCallback(BufferMapCallback* mapCallback, BufferUnmapCallback* unmapCallback) noexcept {
@@ -4037,9 +5218,25 @@ void fg::Parser::setExtrasParseCallback(ExtrasParseCallback *extrasCallback) noe
 	config.extrasCallback = extrasCallback;
 }
 
+void fg::Parser::setParallelTaskCallback(ParallelTaskCallback* parallelTaskCallback) noexcept {
+	config.parallelTaskCallback = parallelTaskCallback;
+}
+
+void fg::Parser::setMemoryResourceSizeHint([[maybe_unused]] std::size_t bytes) noexcept {
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+	memoryResourceSizeHint = bytes;
+#endif
+}
+
 void fg::Parser::setUserPointer(void* pointer) noexcept {
     config.userPointer = pointer;
 }
+
+#if FASTGLTF_ENABLE_STATISTICS
+const fg::Statistics& fg::Parser::getStatistics() const noexcept {
+	return statistics;
+}
+#endif
 #pragma endregion
 
 #pragma region Exporter
@@ -4147,6 +5344,12 @@ void fg::Exporter::setUserPointer(void* pointer) noexcept {
 	userPointer = pointer;
 }
 
+#if FASTGLTF_ENABLE_STATISTICS
+const fg::Statistics& fg::Exporter::getStatistics() const noexcept {
+	return statistics;
+}
+#endif
+
 void fg::Exporter::writeAccessors(const Asset& asset, std::string& json) {
 	if (asset.accessors.empty())
 		return;
@@ -5447,19 +6650,26 @@ std::string fg::Exporter::writeJson(const fastgltf::Asset &asset) {
 		outputString += ']';
 	}
 
-    writeAccessors(asset, outputString);
-    writeAnimations(asset, outputString);
-    writeBuffers(asset, outputString);
-    writeBufferViews(asset, outputString);
-    writeCameras(asset, outputString);
-    writeImages(asset, outputString);
-    writeMaterials(asset, outputString);
-    writeMeshes(asset, outputString);
-    writeNodes(asset, outputString);
-    writeSamplers(asset, outputString);
-    writeScenes(asset, outputString);
-    writeSkins(asset, outputString);
-    writeTextures(asset, outputString);
+#define WRITE_CATEGORY(name) {                                               \
+        FASTGLTF_IF_STATISTICS(StatisticsScope statisticsScope(statistics[Category::name], outputString);) \
+        write##name(asset, outputString);                                   \
+    }
+
+    WRITE_CATEGORY(Accessors)
+    WRITE_CATEGORY(Animations)
+    WRITE_CATEGORY(Buffers)
+    WRITE_CATEGORY(BufferViews)
+    WRITE_CATEGORY(Cameras)
+    WRITE_CATEGORY(Images)
+    WRITE_CATEGORY(Materials)
+    WRITE_CATEGORY(Meshes)
+    WRITE_CATEGORY(Nodes)
+    WRITE_CATEGORY(Samplers)
+    WRITE_CATEGORY(Scenes)
+    WRITE_CATEGORY(Skins)
+    WRITE_CATEGORY(Textures)
+
+#undef WRITE_CATEGORY
     writeExtensions(asset, outputString);
 
     outputString += "}";
@@ -5474,6 +6684,7 @@ std::string fg::Exporter::writeJson(const fastgltf::Asset &asset) {
 fg::Expected<fg::ExportResult<std::string>> fg::Exporter::writeGltfJson(const Asset& asset, ExportOptions _options) {
     bufferPaths.clear();
     imagePaths.clear();
+	FASTGLTF_IF_STATISTICS(statistics = {};)
     options = _options;
 	exportingBinary = false;
 
@@ -5500,6 +6711,7 @@ fg::Expected<fg::ExportResult<std::string>> fg::Exporter::writeGltfJson(const As
 fg::Expected<fg::ExportResult<std::vector<std::byte>>> fg::Exporter::writeGltfBinary(const Asset& asset, ExportOptions _options) {
     bufferPaths.clear();
     imagePaths.clear();
+	FASTGLTF_IF_STATISTICS(statistics = {};)
     options = _options;
 	exportingBinary = true;
 
@@ -57,6 +57,7 @@ extern "C++" {
 
 #include <fastgltf/core.hpp>
 #include <fastgltf/base64.hpp>
+#include <fastgltf/meshopt.hpp>
 #include <fastgltf/tools.hpp>
 
 #if defined(__clang__)
@@ -24,6 +24,10 @@
  * OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include <array>
+#include <mutex>
+#include <unordered_map>
+
 #include <simdjson.h>
 
 #include <fastgltf/core.hpp>
@@ -38,10 +42,25 @@
 #include <windows.h>
 #endif
 
+#if defined(FASTGLTF_HAS_IO_URING)
+#include <cerrno>
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
 namespace fs = std::filesystem;
 namespace fg = fastgltf;
 
 #pragma region glTF file loading
+void fg::GltfDataGetter::skip(std::size_t count) {
+	std::array<std::byte, 4096> discarded; // NOLINT(*-pro-type-member-init)
+	while (count > 0) {
+		const auto chunk = std::min(count, discarded.size());
+		read(discarded.data(), chunk);
+		count -= chunk;
+	}
+}
+
 fg::GltfDataBuffer::GltfDataBuffer(const fs::path& path) noexcept {
 	std::error_code ec;
 	dataSize = static_cast<std::streamsize>(fs::file_size(path, ec));
@@ -104,6 +123,10 @@ fg::span<std::byte> fg::GltfDataBuffer::read(std::size_t count, std::size_t padd
 	return sub;
 }
 
+void fg::GltfDataBuffer::skip(std::size_t count) {
+	idx += count;
+}
+
 void fg::GltfDataBuffer::reset() {
 	idx = 0;
 }
@@ -141,6 +164,10 @@ fg::span<std::byte> fg::GltfFileStream::read(std::size_t count, std::size_t padd
 	return span<std::byte>(reinterpret_cast<std::byte*>(buf.data()), buf.size());
 }
 
+void fg::GltfFileStream::skip(std::size_t count) {
+	fileStream.seekg(static_cast<std::streamoff>(count), std::ifstream::cur);
+}
+
 void fg::GltfFileStream::reset() {
 	fileStream.seekg(0, std::ifstream::beg);
 }
@@ -159,41 +186,50 @@ fg::MappedGltfFile::MappedGltfFile(const fs::path& path) noexcept {
 	// Create file with FILE_FLAG_SEQUENTIAL_SCAN flag, to match the Parser behaviour.
 	auto* file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
 							 OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
-	if (file == nullptr) {
+	if (file == INVALID_HANDLE_VALUE) {
 		error = Error::InvalidPath;
 		return;
 	}
-	fileHandle = file;
 
 	LARGE_INTEGER result;
-	if (GetFileSizeEx(fileHandle, &result) == FALSE) {
+	if (GetFileSizeEx(file, &result) == FALSE) {
+		CloseHandle(file);
 		error = Error::InvalidPath;
 		return;
 	}
-	fileSize = static_cast<std::uint64_t>(result.QuadPart);;
+	fileSize = static_cast<std::uint64_t>(result.QuadPart);
 
 	// Create the file mapping
-	auto* mapping = CreateFileMapping(fileHandle, nullptr, PAGE_READONLY,
+	auto* fileMapping = CreateFileMapping(file, nullptr, PAGE_READONLY,
 									  0, 0, nullptr);
-	if (mapping == nullptr) {
+	if (fileMapping == nullptr) {
+		CloseHandle(file);
 		error = Error::FileBufferAllocationFailed;
 		return;
 	}
-	fileMapping = mapping;
 
 	// Map the view
 	auto* map = MapViewOfFile(fileMapping, FILE_MAP_READ,
 							 0, 0, fileSize);
 	if (map == nullptr) {
+		CloseHandle(fileMapping);
+		CloseHandle(file);
 		error = Error::FileBufferAllocationFailed;
 		return;
 	}
+
+	// Windows requires us to keep the file handle alive, until the view has been unmapped.
 	mappedFile = map;
+	mapping = std::shared_ptr<void>(map, [file, fileMapping](void* view) {
+		UnmapViewOfFile(view);
+		CloseHandle(fileMapping);
+		CloseHandle(file);
+	});
 #else
-fg::MappedGltfFile::MappedGltfFile(const fs::path& path) noexcept : mappedFile(MAP_FAILED) {
+fg::MappedGltfFile::MappedGltfFile(const fs::path& path) noexcept {
 	// Open the file
 	int fd = open(path.c_str(), O_RDONLY, 0);
-	if (fd == 0) {
+	if (fd < 0) {
 		// TODO: Cover actual error messages using std::strerror(errno)?
 		error = Error::InvalidPath;
 		return;
@@ -202,22 +238,28 @@ fg::MappedGltfFile::MappedGltfFile(const fs::path& path) noexcept : mappedFile(M
 	// Get the file size
 	struct stat statInfo {};
 	if (fstat(fd, &statInfo) != 0) {
+		close(fd);
 		error = Error::InvalidPath;
 		return;
 	}
 
 	// Map the file
-	mappedFile = mmap(nullptr,
+	auto* map = mmap(nullptr,
 					  statInfo.st_size,
 					  PROT_READ,
 					  MAP_PRIVATE,
 					  fd,
 					  0);
-	if (mappedFile != MAP_FAILED) {
+	if (map != MAP_FAILED) {
 		fileSize = static_cast<std::uint64_t>(statInfo.st_size);
 
 		// Hint about map access
-		madvise(mappedFile, fileSize, MADV_SEQUENTIAL);
+		madvise(map, fileSize, MADV_SEQUENTIAL);
+
+		mappedFile = map;
+		mapping = std::shared_ptr<void>(map, [size = fileSize](void* view) {
+			munmap(view, size);
+		});
 	} else {
 		error = Error::FileBufferAllocationFailed;
 	}
@@ -227,89 +269,426 @@ fg::MappedGltfFile::MappedGltfFile(const fs::path& path) noexcept : mappedFile(M
 #endif
 }
 
-fg::MappedGltfFile::MappedGltfFile(fastgltf::MappedGltfFile &&other) noexcept {
-#if defined(_WIN32)
+fg::MappedGltfFile::MappedGltfFile(fastgltf::MappedGltfFile &&other) noexcept
+		: mapping(std::move(other.mapping)), mappedFile(std::exchange(other.mappedFile, nullptr)),
+		  fileSize(other.fileSize), idx(other.idx), error(other.error) {}
+
+fg::MappedGltfFile& fg::MappedGltfFile::operator=(fastgltf::MappedGltfFile &&other) noexcept {
+	mapping = std::move(other.mapping);
 	mappedFile = std::exchange(other.mappedFile, nullptr);
-	fileMapping = std::exchange(other.fileMapping, nullptr);
-	fileHandle = std::exchange(other.fileHandle, nullptr);
-#else
-	// Make sure that munmap is never called when other gets destructed.
-	mappedFile = std::exchange(other.mappedFile, MAP_FAILED);
-#endif
 	fileSize = other.fileSize;
 	idx = other.idx;
 	error = other.error;
+	return *this;
 }
 
-fg::MappedGltfFile& fg::MappedGltfFile::operator=(fastgltf::MappedGltfFile &&other) noexcept {
-#if defined(_WIN32)
-	if (mappedFile != nullptr) {
-		UnmapViewOfFile(mappedFile);
+fg::MappedGltfFile::~MappedGltfFile() noexcept = default;
+
+void fg::MappedGltfFile::read(void *ptr, std::size_t count) {
+	std::memcpy(ptr, static_cast<std::byte*>(mappedFile) + idx, count);
+	idx += count;
+}
+
+fg::span<std::byte> fg::MappedGltfFile::read(std::size_t count, std::size_t padding) {
+	span<std::byte> sub(static_cast<std::byte*>(mappedFile) + idx, count);
+	idx += count;
+	return sub;
+}
+
+void fg::MappedGltfFile::skip(std::size_t count) {
+	idx += count;
+}
+
+void fg::MappedGltfFile::reset() {
+	idx = 0;
+}
+
+std::size_t fg::MappedGltfFile::bytesRead() {
+	return idx;
+}
+
+std::size_t fg::MappedGltfFile::totalSize() {
+	return fileSize;
+}
+
+std::shared_ptr<const void> fg::MappedGltfFile::getSharedStorage() {
+	return mapping;
+}
+
+struct fg::Parser::MappedFiles {
+	std::mutex mutex;
+	std::unordered_map<std::string, MappedGltfFile> files;
+};
+
+void fg::Parser::resetMappedFiles() {
+	mappedFiles.reset();
+	if (hasBit(options, Options::MapExternalFiles)) {
+		mappedFiles = std::make_shared<MappedFiles>();
 	}
-	mappedFile = std::exchange(other.mappedFile, nullptr);
+}
 
-	if (fileMapping != nullptr) {
-		CloseHandle(fileMapping);
+void fg::Parser::moveMappedFiles(Asset& asset) {
+	if (mappedFiles == nullptr)
+		return;
+
+	// The asset takes ownership of all mappings, which keeps them alive after the files are destroyed.
+	for (auto& [path, file] : mappedFiles->files) {
+		asset.sharedStorage.emplace_back(file.getSharedStorage());
 	}
-	fileMapping = std::exchange(other.fileMapping, nullptr);
+	mappedFiles.reset();
+}
+#endif // FASTGLTF_HAS_MEMORY_MAPPED_FILE
 
-	if (fileHandle != nullptr) {
-		CloseHandle(fileHandle);
+#pragma region IoUringGltfFile
+#if defined(FASTGLTF_HAS_IO_URING)
+/**
+ * Minimal io_uring wrapper, which only supports batched reads. If the ring cannot be created,
+ * because the kernel is too old or io_uring is disabled, all reads are done using pread.
+ */
+class fg::IoUring {
+	int ringFd = -1;
+
+	void* sqRing = MAP_FAILED;
+	std::size_t sqRingSize = 0;
+	void* cqRing = MAP_FAILED;
+	std::size_t cqRingSize = 0;
+	io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+	std::size_t sqesSize = 0;
+
+	unsigned* sqHead = nullptr;
+	unsigned* sqTail = nullptr;
+	unsigned* sqArray = nullptr;
+	unsigned sqMask = 0;
+	unsigned sqEntries = 0;
+
+	unsigned* cqHead = nullptr;
+	unsigned* cqTail = nullptr;
+	io_uring_cqe* cqes = nullptr;
+	unsigned cqMask = 0;
+	unsigned cqEntries = 0;
+
+	// The length of a single read is a 32-bit integer, and Linux never transfers more than ~2 GiB at once.
+	static constexpr std::size_t maxReadSize = 1U << 30;
+
+	void destroy() noexcept {
+		if (sqes != MAP_FAILED)
+			munmap(sqes, sqesSize);
+		if (cqRing != MAP_FAILED && cqRing != sqRing)
+			munmap(cqRing, cqRingSize);
+		if (sqRing != MAP_FAILED)
+			munmap(sqRing, sqRingSize);
+		if (ringFd >= 0)
+			close(ringFd);
+		sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+		sqRing = cqRing = MAP_FAILED;
+		ringFd = -1;
 	}
-	fileHandle = std::exchange(other.fileHandle, nullptr);
-#else
-	if (mappedFile != MAP_FAILED) {
-		munmap(mappedFile, fileSize);
+
+public:
+	struct ReadRequest {
+		int fd;
+		std::uint64_t offset;
+		std::byte* data;
+		std::size_t size;
+		Error error = Error::None;
+	};
+
+	explicit IoUring(unsigned entries) noexcept {
+		io_uring_params params = {};
+		ringFd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+		if (ringFd < 0) {
+			ringFd = -1;
+			return;
+		}
+
+		sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		const bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+		if (singleMmap)
+			sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+
+		sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+		if (sqRing == MAP_FAILED) {
+			destroy();
+			return;
+		}
+		cqRing = singleMmap ? sqRing
+			: mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+		if (cqRing == MAP_FAILED) {
+			destroy();
+			return;
+		}
+		sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+		sqes = static_cast<io_uring_sqe*>(mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES));
+		if (sqes == MAP_FAILED) {
+			destroy();
+			return;
+		}
+
+		auto* sq = static_cast<std::byte*>(sqRing);
+		sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+		sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+		sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+		sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+		sqEntries = params.sq_entries;
+
+		auto* cq = static_cast<std::byte*>(cqRing);
+		cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+		cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+		cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+		cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+		cqEntries = params.cq_entries;
 	}
-	mappedFile = std::exchange(other.mappedFile, MAP_FAILED);
-#endif
+
+	IoUring(const IoUring& other) = delete;
+	IoUring& operator=(const IoUring& other) = delete;
+
+	~IoUring() noexcept {
+		destroy();
+	}
+
+	[[nodiscard]] bool isValid() const noexcept {
+		return ringFd >= 0;
+	}
+
+	static void readBlocking(ReadRequest& request) noexcept {
+		while (request.size > 0) {
+			auto ret = pread(request.fd, request.data, std::min(request.size, maxReadSize), static_cast<off_t>(request.offset));
+			if (ret < 0 && errno == EINTR)
+				continue;
+			if (ret <= 0) {
+				// Either an error, or the file ended before all requested bytes were read.
+				request.error = Error::MissingExternalBuffer;
+				return;
+			}
+			request.data += ret;
+			request.offset += static_cast<std::uint64_t>(ret);
+			request.size -= static_cast<std::size_t>(ret);
+		}
+	}
+
+	/**
+	 * Reads all requests, submitting as many of them at once as the ring allows.
+	 * Partial reads are resubmitted until each request has been completely read or failed.
+	 */
+	void read(span<ReadRequest> requests) noexcept {
+		if (!isValid()) {
+			for (std::size_t i = 0; i < requests.size(); ++i)
+				readBlocking(requests[i]);
+			return;
+		}
+
+		std::vector<std::size_t> queue;
+		queue.reserve(requests.size());
+		for (std::size_t i = 0; i < requests.size(); ++i) {
+			if (requests[i].size > 0)
+				queue.emplace_back(i);
+		}
+
+		std::size_t queueIdx = 0;
+		std::size_t inFlight = 0;
+		auto reapCompletions = [&]() {
+			auto cqIdx = *cqHead;
+			const auto cqEnd = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+			for (; cqIdx != cqEnd; ++cqIdx) {
+				const auto& cqe = cqes[cqIdx & cqMask];
+				auto& request = requests[static_cast<std::size_t>(cqe.user_data)];
+				--inFlight;
+
+				if (cqe.res > 0) {
+					request.data += cqe.res;
+					request.offset += static_cast<std::uint64_t>(cqe.res);
+					request.size -= static_cast<std::size_t>(cqe.res);
+					if (request.size > 0)
+						queue.emplace_back(static_cast<std::size_t>(cqe.user_data));
+				} else if (cqe.res == 0) {
+					request.error = Error::MissingExternalBuffer;
+				} else {
+					// Kernels before 5.6 do not support IORING_OP_READ, and some files
+					// do not support async reads at all. Just read these with pread.
+					readBlocking(request);
+				}
+			}
+			__atomic_store_n(cqHead, cqIdx, __ATOMIC_RELEASE);
+		};
+
+		while (queueIdx < queue.size() || inFlight > 0) {
+			// Fill the submission queue. The tail is only ever written by us.
+			auto tail = *sqTail;
+			const auto head = __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+			while (queueIdx < queue.size() && tail - head < sqEntries && inFlight < cqEntries) {
+				const auto requestIdx = queue[queueIdx++];
+				auto& request = requests[requestIdx];
+
+				const auto index = tail & sqMask;
+				auto& sqe = sqes[index];
+				std::memset(&sqe, 0, sizeof sqe);
+				sqe.opcode = IORING_OP_READ;
+				sqe.fd = request.fd;
+				sqe.off = request.offset;
+				sqe.addr = reinterpret_cast<std::uint64_t>(request.data);
+				sqe.len = static_cast<std::uint32_t>(std::min(request.size, maxReadSize));
+				sqe.user_data = requestIdx;
+				sqArray[index] = index;
+				++tail;
+				++inFlight;
+			}
+			__atomic_store_n(sqTail, tail, __ATOMIC_RELEASE);
+
+			const auto toSubmit = tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+			auto ret = syscall(__NR_io_uring_enter, ringFd, toSubmit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+			if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+				// The ring is unusable. Take back the entries the kernel has not consumed yet, and wait
+				// for the reads that are still in flight, as the kernel might otherwise still write into
+				// the buffers after the ring is unmapped. Then read what is still left synchronously.
+				const auto consumedTail = __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+				inFlight -= tail - consumedTail;
+				__atomic_store_n(sqTail, consumedTail, __ATOMIC_RELEASE);
+				while (inFlight > 0) {
+					reapCompletions();
+					if (inFlight == 0)
+						break;
+					if (syscall(__NR_io_uring_enter, ringFd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 && errno != EINTR)
+						break;
+				}
+				destroy();
+				for (std::size_t i = 0; i < requests.size(); ++i) {
+					if (requests[i].size > 0 && requests[i].error == Error::None)
+						readBlocking(requests[i]);
+				}
+				return;
+			}
+
+			reapCompletions();
+		}
+	}
+};
+
+fg::IoUringGltfFile::IoUringGltfFile(const fs::path& path) noexcept {
+	fileDescriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fileDescriptor < 0) {
+		error = Error::InvalidPath;
+		return;
+	}
+
+	struct stat statInfo;
+	if (fstat(fileDescriptor, &statInfo) != 0) {
+		error = Error::InvalidPath;
+		return;
+	}
+	fileSize = static_cast<std::uint64_t>(statInfo.st_size);
+
+	// Reads are issued one at a time, so a tiny ring is enough.
+	ring = std::unique_ptr<IoUring>(new(std::nothrow) IoUring(4));
+	if (ring == nullptr) {
+		error = Error::FileBufferAllocationFailed;
+		return;
+	}
+
+	// The read-ahead is padded, so that the JSON can be parsed in-place if it fits.
+	readAheadSize = static_cast<std::size_t>(std::min<std::uint64_t>(fileSize, 64 * 1024));
+	readAhead = decltype(readAhead)(new(std::nothrow) std::byte[readAheadSize + simdjson::SIMDJSON_PADDING]);
+	if (readAhead == nullptr) {
+		error = Error::FileBufferAllocationFailed;
+		return;
+	}
+	std::memset(readAhead.get() + readAheadSize, 0, simdjson::SIMDJSON_PADDING);
+	if (readAt(readAhead.get(), 0, readAheadSize) != Error::None) {
+		error = Error::InvalidPath;
+	}
+}
+
+fg::IoUringGltfFile::IoUringGltfFile() noexcept = default;
+
+fg::IoUringGltfFile::IoUringGltfFile(IoUringGltfFile&& other) noexcept
+		: fileDescriptor(std::exchange(other.fileDescriptor, -1)), fileSize(other.fileSize), ring(std::move(other.ring)),
+		  readAhead(std::move(other.readAhead)), readAheadSize(std::exchange(other.readAheadSize, 0)), buf(std::move(other.buf)),
+		  idx(std::exchange(other.idx, 0)), error(other.error) {}
+
+fg::IoUringGltfFile& fg::IoUringGltfFile::operator=(IoUringGltfFile&& other) noexcept {
+	if (fileDescriptor >= 0)
+		close(fileDescriptor);
+	fileDescriptor = std::exchange(other.fileDescriptor, -1);
 	fileSize = other.fileSize;
-	idx = other.idx;
+	ring = std::move(other.ring);
+	readAhead = std::move(other.readAhead);
+	readAheadSize = std::exchange(other.readAheadSize, 0);
+	buf = std::move(other.buf);
+	idx = std::exchange(other.idx, 0);
 	error = other.error;
 	return *this;
 }
 
-fg::MappedGltfFile::~MappedGltfFile() noexcept {
-#if defined(_WIN32)
-	if (mappedFile != nullptr) {
-		UnmapViewOfFile(mappedFile);
-	}
-	if (fileMapping != nullptr) {
-		CloseHandle(fileMapping);
+fg::IoUringGltfFile::~IoUringGltfFile() noexcept {
+	if (fileDescriptor >= 0)
+		close(fileDescriptor);
+}
+
+fg::Error fg::IoUringGltfFile::readAt(std::byte* ptr, std::uint64_t offset, std::size_t count) {
+	if (fileDescriptor < 0)
+		return Error::InvalidPath;
+
+	IoUring::ReadRequest request { fileDescriptor, offset, ptr, count };
+	if (ring != nullptr) {
+		ring->read(span<IoUring::ReadRequest>(&request, 1));
+	} else {
+		IoUring::readBlocking(request);
 	}
-	if (fileHandle != nullptr) {
-		CloseHandle(fileHandle);
+	return request.error;
+}
+
+void fg::IoUringGltfFile::read(void* ptr, std::size_t count) {
+	count = static_cast<std::size_t>(std::min<std::uint64_t>(count, idx >= fileSize ? 0 : fileSize - idx));
+	auto* bytes = static_cast<std::byte*>(ptr);
+	if (idx < readAheadSize) {
+		const auto fromReadAhead = std::min(count, readAheadSize - idx);
+		std::memcpy(bytes, readAhead.get() + idx, fromReadAhead);
+		idx += fromReadAhead;
+		bytes += fromReadAhead;
+		count -= fromReadAhead;
 	}
-#else
-	if (mappedFile != MAP_FAILED) {
-		munmap(mappedFile, fileSize);
+	if (count > 0) {
+		// The file was truncated or could not be read, which the parser checks for through readError().
+		if (readAt(bytes, idx, count) != Error::None)
+			error = Error::InvalidPath;
+		idx += count;
 	}
-#endif
 }
 
-void fg::MappedGltfFile::read(void *ptr, std::size_t count) {
-	std::memcpy(ptr, static_cast<std::byte*>(mappedFile) + idx, count);
-	idx += count;
+fg::span<std::byte> fg::IoUringGltfFile::read(std::size_t count, std::size_t padding) {
+	// Directly return the read-ahead if the data and padding are contained in it.
+	if (idx + count <= readAheadSize && idx + count + padding <= readAheadSize + simdjson::SIMDJSON_PADDING) {
+		span<std::byte> ret(readAhead.get() + idx, count + padding);
+		idx += count;
+		return ret;
+	}
+
+	buf.resize(count + padding);
+	read(buf.data(), count);
+	return span<std::byte>(buf.data(), buf.size());
 }
 
-fg::span<std::byte> fg::MappedGltfFile::read(std::size_t count, std::size_t padding) {
-	span<std::byte> sub(static_cast<std::byte*>(mappedFile) + idx, count);
+void fg::IoUringGltfFile::skip(std::size_t count) {
 	idx += count;
-	return sub;
 }
 
-void fg::MappedGltfFile::reset() {
+void fg::IoUringGltfFile::reset() {
 	idx = 0;
 }
 
-std::size_t fg::MappedGltfFile::bytesRead() {
+std::size_t fg::IoUringGltfFile::bytesRead() {
 	return idx;
 }
 
-std::size_t fg::MappedGltfFile::totalSize() {
+std::size_t fg::IoUringGltfFile::totalSize() {
 	return fileSize;
 }
-#endif // FASTGLTF_HAS_MEMORY_MAPPED_FILE
+
+fg::Error fg::IoUringGltfFile::readError() const noexcept {
+	return error;
+}
+#endif // FASTGLTF_HAS_IO_URING
+#pragma endregion
 
 #pragma region AndroidGltfDataBuffer
 #if defined(__ANDROID__)
@@ -402,12 +781,13 @@ fg::Expected<fg::DataSource> fg::Parser::loadFileFromApk(const fs::path& path) c
 }
 #endif
 
-fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noexcept {
-	URI decodedUri(uri.path()); // Re-allocate so we can decode potential characters.
-	// JSON strings are always in UTF-8, so we can safely always use u8path here.
-	// Since u8path is deprecated with C++20 and newer, u8path is deprecated.
-	// As there is no other proper solution that doesn't do something illegal,
-	// we'll just disable related warnings here.
+namespace fastgltf {
+	[[nodiscard]] static fs::path getLocalPath(const fs::path& directory, URIView& uri) {
+		URI decodedUri(uri.path()); // Re-allocate so we can decode potential characters.
+		// JSON strings are always in UTF-8, so we can safely always use u8path here.
+		// Since u8path is deprecated with C++20 and newer, u8path is deprecated.
+		// As there is no other proper solution that doesn't do something illegal,
+		// we'll just disable related warnings here.
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -415,12 +795,17 @@ fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noe
 #pragma warning(push)
 #pragma warning(disable : 4996)
 #endif
-	auto path = directory / fs::u8path(decodedUri.path());
+		return directory / fs::u8path(decodedUri.path());
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic pop
 #elif defined(_MSC_VER)
 #pragma warning(pop)
 #endif
+	}
+} // namespace fastgltf
+
+fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noexcept {
+	auto path = getLocalPath(directory, uri);
 
 #if defined(__ANDROID__)
 	if (androidAssetManager != nullptr) {
@@ -442,6 +827,27 @@ fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noe
 		return Error::InvalidURI;
 	}
 
+#if defined(FASTGLTF_HAS_MEMORY_MAPPED_FILE)
+	// Empty files cannot be mapped, and are simply loaded into an empty array.
+	if (mappedFiles != nullptr && length != 0) {
+		std::lock_guard lock(mappedFiles->mutex);
+		auto it = mappedFiles->files.find(path.lexically_normal().string());
+		if (it == mappedFiles->files.end()) {
+			auto mappedFile = MappedGltfFile::FromPath(path);
+			if (mappedFile.error() != Error::None) {
+				return mappedFile.error();
+			}
+			it = mappedFiles->files.emplace(path.lexically_normal().string(), std::move(mappedFile.get())).first;
+		}
+
+		auto bytes = static_cast<span<std::byte>>(it->second);
+		sources::ByteView byteViewSource {
+			span<const std::byte>(bytes.data(), bytes.size()),
+		};
+		return { byteViewSource };
+	}
+#endif
+
 	std::ifstream file(path, std::ios::binary);
 
 	if (config.mapCallback != nullptr) {
@@ -464,4 +870,70 @@ fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noe
 	};
 	return { std::move(arraySource) };
 }
+#if defined(FASTGLTF_HAS_IO_URING)
+void fg::Parser::readExternalFiles(span<ExternalFile> files) const {
+	struct OpenFile {
+		int fd = -1;
+		std::optional<BufferInfo> mapped;
+	};
+	std::vector<OpenFile> openFiles(files.size());
+	std::vector<IoUring::ReadRequest> requests;
+	std::vector<std::size_t> requestFiles;
+	requests.reserve(files.size());
+	requestFiles.reserve(files.size());
+
+	// Open all files and allocate their destination memory up front.
+	for (std::size_t i = 0; i < files.size(); ++i) {
+		auto& file = files[i];
+		URIView uriView = std::get<sources::URI>(*file.data).uri;
+		auto path = getLocalPath(directory, uriView);
+
+		auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		struct stat statInfo;
+		if (fd < 0 || fstat(fd, &statInfo) != 0) {
+			if (fd >= 0)
+				close(fd);
+			file.error = Error::MissingExternalBuffer;
+			continue;
+		}
+		openFiles[i].fd = fd;
+
+		const auto length = static_cast<std::size_t>(statInfo.st_size);
+		std::byte* destination = nullptr;
+		if (config.mapCallback != nullptr) {
+			auto info = config.mapCallback(static_cast<std::uint64_t>(length), config.userPointer);
+			if (info.mappedMemory != nullptr) {
+				destination = static_cast<std::byte*>(info.mappedMemory);
+				*file.data = sources::CustomBuffer { info.customId };
+				openFiles[i].mapped = info;
+			}
+		}
+		if (destination == nullptr) {
+			*file.data = sources::Array { StaticVector<std::byte>(length) };
+			destination = std::get<sources::Array>(*file.data).bytes.data();
+		}
+
+		if (length > 0) {
+			requests.push_back({ fd, 0, destination, length });
+			requestFiles.emplace_back(i);
+		}
+	}
+
+	// Submit all reads in a single batch. The ring is sized for the number of files,
+	// while the kernel clamps the entries to its maximum.
+	IoUring ring(static_cast<unsigned>(std::clamp<std::size_t>(requests.size(), 1, 4096)));
+	ring.read(span<IoUring::ReadRequest>(requests.data(), requests.size()));
+
+	for (std::size_t i = 0; i < requests.size(); ++i) {
+		if (requests[i].error != Error::None)
+			files[requestFiles[i]].error = requests[i].error;
+	}
+	for (auto& openFile : openFiles) {
+		if (openFile.mapped.has_value() && config.unmapCallback != nullptr)
+			config.unmapCallback(&*openFile.mapped, config.userPointer);
+		if (openFile.fd >= 0)
+			close(openFile.fd);
+	}
+}
+#endif
 #pragma endregion
@@ -0,0 +1,865 @@
+/*
+ * Copyright (C) 2022 - 2024 spnda
+ * This file is part of fastgltf <https://github.com/spnda/fastgltf>.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#if !defined(__cplusplus) || (!defined(_MSVC_LANG) && __cplusplus < 201703L) || (defined(_MSVC_LANG) && _MSVC_LANG < 201703L)
+#error "fastgltf requires C++17"
+#endif
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "simdjson.h"
+
+#include <fastgltf/meshopt.hpp>
+
+#if defined(FASTGLTF_IS_X86)
+#if defined(__clang__) || defined(__GNUC__)
+// See base64.cpp on why these are included manually.
+#include <immintrin.h>
+#include <smmintrin.h>
+#else
+#include <intrin.h>
+#endif
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 5030) // attribute 'x' is not recognized
+#pragma warning(disable : 4710) // function not inlined
+#endif
+
+namespace fg = fastgltf;
+
+namespace fastgltf::meshopt {
+	constexpr std::uint8_t vertexHeader = 0xA0;
+	constexpr std::uint8_t indexHeader = 0xE0;
+	constexpr std::uint8_t sequenceHeader = 0xD0;
+
+	// Every byte of a vertex is encoded as a stream of groups of 16 deltas.
+	constexpr std::size_t byteGroupSize = 16;
+	// The largest amount of bytes a single byte group can occupy, including the sentinel bytes.
+	constexpr std::size_t byteGroupDecodeLimit = 24;
+	constexpr std::size_t vertexBlockSizeBytes = 8192;
+	constexpr std::size_t vertexBlockMaxSize = 256;
+	constexpr std::size_t tailMaxSize = 32;
+
+	using DecodeVertexBufferFunction = bool(*)(std::byte*, std::size_t, std::size_t, span<const std::byte>);
+	using DecodeFilterFunction = void(*)(MeshoptCompressionFilter, std::byte*, std::size_t, std::size_t);
+
+	struct DecodeFunctionGetter {
+		DecodeVertexBufferFunction vertexBuffer = fallback_decode_vertex_buffer;
+		DecodeFilterFunction filter = fallback_decode_filter;
+
+		explicit DecodeFunctionGetter() {
+			// Same as with the base64 decoders, we use simdjson to determine the supported instruction sets.
+			const auto& impls = simdjson::get_available_implementations();
+#if defined(FASTGLTF_IS_X86)
+			if (const auto* sse4 = impls["westmere"]; sse4 != nullptr && sse4->supported_by_runtime_system()) {
+				vertexBuffer = sse4_decode_vertex_buffer;
+				filter = sse4_decode_filter;
+			}
+#else
+			(void)impls;
+#endif
+		}
+
+		static DecodeFunctionGetter* get() {
+			static DecodeFunctionGetter getter;
+			return &getter;
+		}
+	};
+
+	/** Returns the number of vertices in a block, so that a whole block fits into vertexBlockSizeBytes. */
+	std::size_t getVertexBlockSize(std::size_t byteStride) {
+		const auto result = (vertexBlockSizeBytes / byteStride) & ~(byteGroupSize - 1);
+		return result < vertexBlockMaxSize ? result : vertexBlockMaxSize;
+	}
+
+	FASTGLTF_FORCEINLINE std::uint8_t unzigzag8(std::uint8_t value) {
+		return static_cast<std::uint8_t>(-(value & 1) ^ (value >> 1));
+	}
+
+	FASTGLTF_FORCEINLINE std::uint32_t decodeVByte(const std::uint8_t*& data) {
+		const auto lead = *data++;
+		if (lead < 128)
+			return lead;
+
+		// The loop always terminates after at most 4 more bytes, which is important for malformed data.
+		std::uint32_t result = lead & 127;
+		std::uint32_t shift = 7;
+		for (std::size_t i = 0; i < 4; ++i) {
+			const auto group = *data++;
+			result |= static_cast<std::uint32_t>(group & 127) << shift;
+			shift += 7;
+			if (group < 128)
+				break;
+		}
+		return result;
+	}
+
+	FASTGLTF_FORCEINLINE std::uint32_t decodeIndex(const std::uint8_t*& data, std::uint32_t last) {
+		const auto value = decodeVByte(data);
+		return last + ((value >> 1) ^ (0U - (value & 1)));
+	}
+
+	FASTGLTF_FORCEINLINE void writeIndex(std::byte* destination, std::size_t index, std::size_t indexSize, std::uint32_t value) {
+		if (indexSize == 2) {
+			const auto shortValue = static_cast<std::uint16_t>(value);
+			std::memcpy(destination + index * sizeof shortValue, &shortValue, sizeof shortValue);
+		} else {
+			std::memcpy(destination + index * sizeof value, &value, sizeof value);
+		}
+	}
+
+	/**
+	 * Decodes the vertex buffer header and then every block using decodeBlock, after which only the tail
+	 * holding the first vertex may remain.
+	 */
+	template <typename BlockDecoder>
+	FASTGLTF_FORCEINLINE bool decodeVertexBlocks(std::byte* destination, std::size_t count, std::size_t byteStride,
+			span<const std::byte> source, BlockDecoder&& decodeBlock) {
+		if (byteStride == 0 || byteStride > 256 || byteStride % 4 != 0)
+			return false;
+		if (source.size() < 1 + byteStride)
+			return false;
+
+		const auto* data = reinterpret_cast<const std::uint8_t*>(source.data());
+		const auto* end = data + source.size();
+
+		const auto header = *data++;
+		if ((header & 0xF0) != vertexHeader || (header & 0x0F) > 0)
+			return false;
+
+		// The deltas of the first block are relative to the first vertex, stored at the very end.
+		std::uint8_t lastVertex[256];
+		std::memcpy(lastVertex, end - byteStride, byteStride);
+
+		const auto blockSize = getVertexBlockSize(byteStride);
+		auto* vertexData = reinterpret_cast<std::uint8_t*>(destination);
+		for (std::size_t offset = 0; offset < count; offset += blockSize) {
+			const auto blockCount = blockSize < count - offset ? blockSize : count - offset;
+			data = decodeBlock(data, end, vertexData + offset * byteStride, blockCount, byteStride, lastVertex);
+			if (data == nullptr)
+				return false;
+		}
+
+		const auto tailSize = byteStride < tailMaxSize ? tailMaxSize : byteStride;
+		return static_cast<std::size_t>(end - data) == tailSize;
+	}
+
+	const std::uint8_t* decodeBytesGroup(const std::uint8_t* data, std::uint8_t* buffer, unsigned bitsLog2) {
+		switch (bitsLog2) {
+			case 0:
+				std::memset(buffer, 0, byteGroupSize);
+				return data;
+			case 1:
+			case 2: {
+				// The deltas are packed from the most significant bits, and the largest value of each
+				// bit width is a sentinel for a full byte stored after the packed deltas.
+				const unsigned bits = 1U << bitsLog2;
+				const unsigned sentinel = (1U << bits) - 1;
+				const auto* sentinels = data + bits * 2;
+				for (std::size_t i = 0; i < byteGroupSize; ++i) {
+					const auto shift = 8 - bits - (i * bits) % 8;
+					const auto value = static_cast<unsigned>(data[i * bits / 8] >> shift) & sentinel;
+					buffer[i] = value == sentinel ? *sentinels++ : static_cast<std::uint8_t>(value);
+				}
+				return sentinels;
+			}
+			default:
+				std::memcpy(buffer, data, byteGroupSize);
+				return data + byteGroupSize;
+		}
+	}
+
+	/** Decodes size bytes of a single byte stream, prefixed with the 2-bit modes of every group. */
+	template <typename GroupDecoder>
+	FASTGLTF_FORCEINLINE const std::uint8_t* decodeBytes(const std::uint8_t* data, const std::uint8_t* end,
+			std::uint8_t* buffer, std::size_t size, GroupDecoder&& decodeGroup) {
+		const auto* header = data;
+		const auto headerSize = (size / byteGroupSize + 3) / 4;
+		if (static_cast<std::size_t>(end - data) < headerSize)
+			return nullptr;
+
+		data += headerSize;
+		for (std::size_t i = 0; i < size; i += byteGroupSize) {
+			// The SIMD decoders read a whole byte group limit, which every valid stream provides.
+			if (static_cast<std::size_t>(end - data) < byteGroupDecodeLimit)
+				return nullptr;
+
+			const auto group = i / byteGroupSize;
+			const auto bitsLog2 = static_cast<unsigned>(header[group / 4] >> ((group % 4) * 2)) & 3U;
+			data = decodeGroup(data, buffer + i, bitsLog2);
+		}
+		return data;
+	}
+
+	const std::uint8_t* decodeVertexBlock(const std::uint8_t* data, const std::uint8_t* end, std::uint8_t* vertexData,
+			std::size_t vertexCount, std::size_t byteStride, std::uint8_t* lastVertex) {
+		std::uint8_t buffer[vertexBlockMaxSize];
+		const auto alignedCount = (vertexCount + byteGroupSize - 1) & ~(byteGroupSize - 1);
+
+		for (std::size_t k = 0; k < byteStride; ++k) {
+			data = decodeBytes(data, end, buffer, alignedCount, decodeBytesGroup);
+			if (data == nullptr)
+				return nullptr;
+
+			auto previous = lastVertex[k];
+			for (std::size_t i = 0; i < vertexCount; ++i) {
+				previous = static_cast<std::uint8_t>(unzigzag8(buffer[i]) + previous);
+				vertexData[i * byteStride + k] = previous;
+			}
+		}
+
+		std::memcpy(lastVertex, vertexData + byteStride * (vertexCount - 1), byteStride);
+		return data;
+	}
+
+	template <typename T>
+	FASTGLTF_FORCEINLINE T load(const std::byte* data, std::size_t index) {
+		T value;
+		std::memcpy(&value, data + index * sizeof(T), sizeof(T));
+		return value;
+	}
+
+	template <typename T>
+	FASTGLTF_FORCEINLINE void store(std::byte* data, std::size_t index, T value) {
+		std::memcpy(data + index * sizeof(T), &value, sizeof(T));
+	}
+
+	/** Rounds to the nearest integer, with halfway cases rounded away from zero. */
+	FASTGLTF_FORCEINLINE int roundToInt(float value) {
+		return static_cast<int>(value + (value >= 0.0f ? 0.5f : -0.5f));
+	}
+
+	template <typename T>
+	void decodeFilterOctahedral(std::byte* data, std::size_t count, std::size_t first = 0) {
+		constexpr auto max = static_cast<float>((1 << (sizeof(T) * 8 - 1)) - 1);
+		for (std::size_t i = first; i < count; ++i) {
+			// Reconstruct z from x and y, as the encoder makes sure that z encodes 1.0 at the same bit count.
+			auto x = static_cast<float>(load<T>(data, i * 4 + 0));
+			auto y = static_cast<float>(load<T>(data, i * 4 + 1));
+			const auto z = static_cast<float>(load<T>(data, i * 4 + 2)) - std::fabs(x) - std::fabs(y);
+
+			// Fix up the octahedral coordinates for z < 0.
+			const auto t = z < 0.0f ? z : 0.0f;
+			x += x >= 0.0f ? t : -t;
+			y += y >= 0.0f ? t : -t;
+
+			// Malformed data might encode a zero vector, which is left as zero.
+			const auto length = std::sqrt(x * x + y * y + z * z);
+			const auto scale = length > 0.0f ? max / length : 0.0f;
+
+			store<T>(data, i * 4 + 0, static_cast<T>(roundToInt(x * scale)));
+			store<T>(data, i * 4 + 1, static_cast<T>(roundToInt(y * scale)));
+			store<T>(data, i * 4 + 2, static_cast<T>(roundToInt(z * scale)));
+		}
+	}
+
+	void decodeFilterQuaternion(std::byte* data, std::size_t count, std::size_t first = 0) {
+		const auto scale = 1.0f / std::sqrt(2.0f);
+		for (std::size_t i = first; i < count; ++i) {
+			// The scale is stored in the high bits of the fourth component.
+			const auto w = load<std::int16_t>(data, i * 4 + 3);
+			const auto componentScale = scale / static_cast<float>(w | 3);
+
+			const auto x = static_cast<float>(load<std::int16_t>(data, i * 4 + 0)) * componentScale;
+			const auto y = static_cast<float>(load<std::int16_t>(data, i * 4 + 1)) * componentScale;
+			const auto z = static_cast<float>(load<std::int16_t>(data, i * 4 + 2)) * componentScale;
+
+			// Reconstruct the largest component, clamping to avoid NaNs caused by precision errors.
+			const auto ww = 1.0f - x * x - y * y - z * z;
+			const auto largest = std::sqrt(ww >= 0.0f ? ww : 0.0f);
+
+			// The lowest two bits of the fourth component are the index of the largest component.
+			const auto index = static_cast<std::size_t>(w & 3);
+			store<std::int16_t>(data, i * 4 + ((index + 1) & 3), static_cast<std::int16_t>(roundToInt(x * 32767.0f)));
+			store<std::int16_t>(data, i * 4 + ((index + 2) & 3), static_cast<std::int16_t>(roundToInt(y * 32767.0f)));
+			store<std::int16_t>(data, i * 4 + ((index + 3) & 3), static_cast<std::int16_t>(roundToInt(z * 32767.0f)));
+			store<std::int16_t>(data, i * 4 + index, static_cast<std::int16_t>(static_cast<int>(largest * 32767.0f + 0.5f)));
+		}
+	}
+
+	void decodeFilterExponential(std::byte* data, std::size_t count, std::size_t first = 0) {
+		for (std::size_t i = first; i < count; ++i) {
+			// A signed 24-bit mantissa and a signed 8-bit exponent, computing ldexp(mantissa, exponent).
+			const auto value = load<std::uint32_t>(data, i);
+			const auto mantissa = static_cast<std::int32_t>(value << 8) >> 8;
+			const auto exponent = static_cast<std::int32_t>(value) >> 24;
+
+			const auto power = bit_cast<float>(static_cast<std::uint32_t>(exponent + 127) << 23);
+			store<float>(data, i, power * static_cast<float>(mantissa));
+		}
+	}
+} // namespace fastgltf::meshopt
+
+bool fg::meshopt::fallback_decode_vertex_buffer(std::byte* destination, std::size_t count, std::size_t byteStride, span<const std::byte> source) {
+	return decodeVertexBlocks(destination, count, byteStride, source, decodeVertexBlock);
+}
+
+void fg::meshopt::fallback_decode_filter(MeshoptCompressionFilter filter, std::byte* data, std::size_t count, std::size_t byteStride) {
+	switch (filter) {
+		case MeshoptCompressionFilter::None:
+			break;
+		case MeshoptCompressionFilter::Octahedral:
+			if (byteStride == 4) {
+				decodeFilterOctahedral<std::int8_t>(data, count);
+			} else {
+				decodeFilterOctahedral<std::int16_t>(data, count);
+			}
+			break;
+		case MeshoptCompressionFilter::Quaternion:
+			decodeFilterQuaternion(data, count);
+			break;
+		case MeshoptCompressionFilter::Exponential:
+			decodeFilterExponential(data, count * (byteStride / 4));
+			break;
+	}
+}
+
+#if defined(FASTGLTF_IS_X86)
+namespace fastgltf::meshopt {
+	/**
+	 * For every 8-bit mask of lanes holding a sentinel, the shuffle which moves the consecutive sentinel
+	 * bytes into these lanes, and the number of sentinel bytes consumed.
+	 */
+	struct SentinelShuffleTable {
+		std::uint8_t shuffle[256][8];
+		std::uint8_t count[256];
+	};
+
+	constexpr SentinelShuffleTable createSentinelShuffleTable() {
+		SentinelShuffleTable table {};
+		for (std::size_t mask = 0; mask < 256; ++mask) {
+			std::uint8_t count = 0;
+			for (std::size_t lane = 0; lane < 8; ++lane) {
+				table.shuffle[mask][lane] = (mask & (1U << lane)) != 0 ? count++ : 0x80;
+			}
+			table.count[mask] = count;
+		}
+		return table;
+	}
+
+	alignas(16) constexpr auto sentinelShuffleTable = createSentinelShuffleTable();
+
+	/**
+	 * Replaces every lane of values which is equal to sentinel with the next byte from rest, and returns
+	 * how many bytes of rest have been consumed.
+	 */
+	[[gnu::target("sse4.1")]] FASTGLTF_FORCEINLINE std::size_t sse4_replace_sentinels(__m128i& values, __m128i sentinel, __m128i rest) {
+		const auto mask = _mm_cmpeq_epi8(values, sentinel);
+		const auto mask16 = static_cast<unsigned>(_mm_movemask_epi8(mask));
+		const auto mask0 = mask16 & 0xFF;
+		const auto mask1 = mask16 >> 8;
+
+		// The shuffle of the upper half starts after the sentinels of the lower half. Adding to the
+		// lanes which don't take a sentinel keeps their highest bit set, so they still become zero.
+		const auto shuffle0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(sentinelShuffleTable.shuffle[mask0]));
+		const auto shuffle1 = _mm_add_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(sentinelShuffleTable.shuffle[mask1])),
+			_mm_set1_epi8(static_cast<char>(sentinelShuffleTable.count[mask0])));
+		const auto shuffle = _mm_unpacklo_epi64(shuffle0, shuffle1);
+
+		values = _mm_or_si128(_mm_shuffle_epi8(rest, shuffle), _mm_andnot_si128(mask, values));
+		return sentinelShuffleTable.count[mask0] + sentinelShuffleTable.count[mask1];
+	}
+
+	[[gnu::target("sse4.1")]] const std::uint8_t* sse4_decode_bytes_group(const std::uint8_t* data, std::uint8_t* buffer, unsigned bitsLog2) {
+		switch (bitsLog2) {
+			case 0:
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(buffer), _mm_setzero_si128());
+				return data;
+			case 1: {
+				// Spread the 2-bit deltas of every byte over four bytes, with the most significant bits first.
+				const auto packed = _mm_cvtsi32_si128(static_cast<int>(load<std::uint32_t>(reinterpret_cast<const std::byte*>(data), 0)));
+				const auto rest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 4));
+
+				const auto nibbles = _mm_unpacklo_epi8(_mm_srli_epi16(packed, 4), packed);
+				const auto pairs = _mm_unpacklo_epi8(_mm_srli_epi16(nibbles, 2), nibbles);
+				auto values = _mm_and_si128(pairs, _mm_set1_epi8(3));
+
+				const auto consumed = sse4_replace_sentinels(values, _mm_set1_epi8(3), rest);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(buffer), values);
+				return data + 4 + consumed;
+			}
+			case 2: {
+				const auto packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data));
+				const auto rest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 8));
+
+				const auto nibbles = _mm_unpacklo_epi8(_mm_srli_epi16(packed, 4), packed);
+				auto values = _mm_and_si128(nibbles, _mm_set1_epi8(15));
+
+				const auto consumed = sse4_replace_sentinels(values, _mm_set1_epi8(15), rest);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(buffer), values);
+				return data + 8 + consumed;
+			}
+			default:
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(buffer), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+				return data + byteGroupSize;
+		}
+	}
+
+	/** Undoes the zigzag encoding and computes the running sum of the deltas, starting from previous. */
+	[[gnu::target("sse4.1")]] FASTGLTF_FORCEINLINE __m128i sse4_decode_deltas(__m128i deltas, __m128i previous) {
+		const auto sign = _mm_sub_epi8(_mm_setzero_si128(), _mm_and_si128(deltas, _mm_set1_epi8(1)));
+		auto values = _mm_xor_si128(sign, _mm_and_si128(_mm_srli_epi16(deltas, 1), _mm_set1_epi8(127)));
+
+		values = _mm_add_epi8(values, _mm_slli_si128(values, 1));
+		values = _mm_add_epi8(values, _mm_slli_si128(values, 2));
+		values = _mm_add_epi8(values, _mm_slli_si128(values, 4));
+		values = _mm_add_epi8(values, _mm_slli_si128(values, 8));
+		return _mm_add_epi8(values, previous);
+	}
+
+	[[gnu::target("sse4.1")]] const std::uint8_t* sse4_decode_vertex_block(const std::uint8_t* data, const std::uint8_t* end,
+			std::uint8_t* vertexData, std::size_t vertexCount, std::size_t byteStride, std::uint8_t* lastVertex) {
+		alignas(16) std::uint8_t buffer[4][vertexBlockMaxSize];
+		alignas(16) std::uint8_t transposed[vertexBlockSizeBytes];
+		const auto alignedCount = (vertexCount + byteGroupSize - 1) & ~(byteGroupSize - 1);
+
+		// The byte stride is a multiple of 4, so we always decode four byte streams at once.
+		for (std::size_t k = 0; k < byteStride; k += 4) {
+			for (std::size_t j = 0; j < 4; ++j) {
+				data = decodeBytes(data, end, buffer[j], alignedCount, sse4_decode_bytes_group);
+				if (data == nullptr)
+					return nullptr;
+
+				auto previous = _mm_set1_epi8(static_cast<char>(lastVertex[k + j]));
+				for (std::size_t i = 0; i < alignedCount; i += byteGroupSize) {
+					auto* group = reinterpret_cast<__m128i*>(&buffer[j][i]);
+					const auto values = sse4_decode_deltas(_mm_load_si128(group), previous);
+					_mm_store_si128(group, values);
+					previous = _mm_shuffle_epi8(values, _mm_set1_epi8(15));
+				}
+			}
+
+			// Interleave the four streams into four bytes per vertex.
+			for (std::size_t i = 0; i < alignedCount; i += byteGroupSize) {
+				const auto s0 = _mm_load_si128(reinterpret_cast<const __m128i*>(&buffer[0][i]));
+				const auto s1 = _mm_load_si128(reinterpret_cast<const __m128i*>(&buffer[1][i]));
+				const auto s2 = _mm_load_si128(reinterpret_cast<const __m128i*>(&buffer[2][i]));
+				const auto s3 = _mm_load_si128(reinterpret_cast<const __m128i*>(&buffer[3][i]));
+
+				const auto t0 = _mm_unpacklo_epi8(s0, s1);
+				const auto t1 = _mm_unpackhi_epi8(s0, s1);
+				const auto t2 = _mm_unpacklo_epi8(s2, s3);
+				const auto t3 = _mm_unpackhi_epi8(s2, s3);
+
+				alignas(16) std::uint32_t vertices[16];
+				_mm_store_si128(reinterpret_cast<__m128i*>(&vertices[0]), _mm_unpacklo_epi16(t0, t2));
+				_mm_store_si128(reinterpret_cast<__m128i*>(&vertices[4]), _mm_unpackhi_epi16(t0, t2));
+				_mm_store_si128(reinterpret_cast<__m128i*>(&vertices[8]), _mm_unpacklo_epi16(t1, t3));
+				_mm_store_si128(reinterpret_cast<__m128i*>(&vertices[12]), _mm_unpackhi_epi16(t1, t3));
+				for (std::size_t v = 0; v < 16; ++v) {
+					std::memcpy(&transposed[(i + v) * byteStride + k], &vertices[v], sizeof(std::uint32_t));
+				}
+			}
+		}
+
+		std::memcpy(vertexData, transposed, vertexCount * byteStride);
+		std::memcpy(lastVertex, &transposed[byteStride * (vertexCount - 1)], byteStride);
+		return data;
+	}
+
+	/** Same as roundToInt, for four floats at once. */
+	[[gnu::target("sse4.1")]] FASTGLTF_FORCEINLINE __m128i sse4_round_to_int(__m128 values) {
+		const auto half = _mm_or_ps(_mm_set1_ps(0.5f), _mm_and_ps(values, _mm_set1_ps(-0.0f)));
+		return _mm_cvttps_epi32(_mm_add_ps(values, half));
+	}
+
+	/** Returns the x, y, and z components of four octahedral normals, corrected and scaled to max. */
+	[[gnu::target("sse4.1")]] FASTGLTF_FORCEINLINE void sse4_decode_octahedral(__m128& x, __m128& y, __m128 z, float max,
+			__m128i& xi, __m128i& yi, __m128i& zi) {
+		const auto absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		z = _mm_sub_ps(_mm_sub_ps(z, _mm_and_ps(x, absMask)), _mm_and_ps(y, absMask));
+
+		// The scalar code adds -t for negative x, which is the same as xoring t with the sign of x.
+		const auto t = _mm_min_ps(z, _mm_setzero_ps());
+		const auto signMask = _mm_set1_ps(-0.0f);
+		x = _mm_add_ps(x, _mm_xor_ps(t, _mm_and_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), signMask)));
+		y = _mm_add_ps(y, _mm_xor_ps(t, _mm_and_ps(_mm_cmplt_ps(y, _mm_setzero_ps()), signMask)));
+
+		const auto length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+		const auto scale = _mm_and_ps(_mm_div_ps(_mm_set1_ps(max), length), _mm_cmpgt_ps(length, _mm_setzero_ps()));
+
+		xi = sse4_round_to_int(_mm_mul_ps(x, scale));
+		yi = sse4_round_to_int(_mm_mul_ps(y, scale));
+		zi = sse4_round_to_int(_mm_mul_ps(z, scale));
+	}
+
+	[[gnu::target("sse4.1")]] void sse4_decode_filter_octahedral8(std::byte* data, std::size_t count) {
+		std::size_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 4));
+
+			auto x = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(input, 24), 24));
+			auto y = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(input, 16), 24));
+			const auto z = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(input, 8), 24));
+
+			__m128i xi, yi, zi;
+			sse4_decode_octahedral(x, y, z, 127.0f, xi, yi, zi);
+
+			const auto byteMask = _mm_set1_epi32(0xFF);
+			auto result = _mm_and_si128(input, _mm_set1_epi32(static_cast<int>(0xFF000000U)));
+			result = _mm_or_si128(result, _mm_and_si128(xi, byteMask));
+			result = _mm_or_si128(result, _mm_slli_epi32(_mm_and_si128(yi, byteMask), 8));
+			result = _mm_or_si128(result, _mm_slli_epi32(_mm_and_si128(zi, byteMask), 16));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(data + i * 4), result);
+		}
+		decodeFilterOctahedral<std::int8_t>(data, count, i);
+	}
+
+	/** Loads four elements of four 16-bit components, and splits them into the first and second pairs of components. */
+	[[gnu::target("sse4.1")]] FASTGLTF_FORCEINLINE void sse4_load_short4(const std::byte* data, __m128i& xy, __m128i& zw) {
+		const auto first = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+		const auto second = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)));
+		xy = _mm_castps_si128(_mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0)));
+		zw = _mm_castps_si128(_mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1)));
+	}
+
+	[[gnu::target("sse4.1")]] FASTGLTF_FORCEINLINE void sse4_store_short4(std::byte* data, __m128i xy, __m128i zw) {
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm_unpacklo_epi32(xy, zw));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(data + 16), _mm_unpackhi_epi32(xy, zw));
+	}
+
+	[[gnu::target("sse4.1")]] void sse4_decode_filter_octahedral16(std::byte* data, std::size_t count) {
+		std::size_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			__m128i xy, zw;
+			sse4_load_short4(data + i * 8, xy, zw);
+
+			auto x = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(xy, 16), 16));
+			auto y = _mm_cvtepi32_ps(_mm_srai_epi32(xy, 16));
+			const auto z = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(zw, 16), 16));
+
+			__m128i xi, yi, zi;
+			sse4_decode_octahedral(x, y, z, 32767.0f, xi, yi, zi);
+
+			const auto shortMask = _mm_set1_epi32(0xFFFF);
+			const auto resultXy = _mm_or_si128(_mm_and_si128(xi, shortMask), _mm_slli_epi32(yi, 16));
+			const auto resultZw = _mm_or_si128(_mm_and_si128(zi, shortMask), _mm_andnot_si128(shortMask, zw));
+			sse4_store_short4(data + i * 8, resultXy, resultZw);
+		}
+		decodeFilterOctahedral<std::int16_t>(data, count, i);
+	}
+
+	[[gnu::target("sse4.1")]] void sse4_decode_filter_quaternion(std::byte* data, std::size_t count) {
+		const auto scale = _mm_set1_ps(1.0f / std::sqrt(2.0f));
+		std::size_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			__m128i xy, zw;
+			sse4_load_short4(data + i * 8, xy, zw);
+
+			const auto w = _mm_srai_epi32(zw, 16);
+			const auto componentScale = _mm_div_ps(scale, _mm_cvtepi32_ps(_mm_or_si128(w, _mm_set1_epi32(3))));
+
+			const auto x = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(xy, 16), 16)), componentScale);
+			const auto y = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(xy, 16)), componentScale);
+			const auto z = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(zw, 16), 16)), componentScale);
+
+			auto ww = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x, x));
+			ww = _mm_sub_ps(_mm_sub_ps(ww, _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+			const auto largest = _mm_sqrt_ps(_mm_max_ps(ww, _mm_setzero_ps()));
+
+			const auto factor = _mm_set1_ps(32767.0f);
+			alignas(16) std::int32_t components[4][4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(components[0]), sse4_round_to_int(_mm_mul_ps(x, factor)));
+			_mm_store_si128(reinterpret_cast<__m128i*>(components[1]), sse4_round_to_int(_mm_mul_ps(y, factor)));
+			_mm_store_si128(reinterpret_cast<__m128i*>(components[2]), sse4_round_to_int(_mm_mul_ps(z, factor)));
+			_mm_store_si128(reinterpret_cast<__m128i*>(components[3]),
+				_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(largest, factor), _mm_set1_ps(0.5f))));
+
+			// The order of the components depends on the index of the largest component of each element.
+			alignas(16) std::int32_t indices[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(indices), _mm_and_si128(w, _mm_set1_epi32(3)));
+			for (std::size_t e = 0; e < 4; ++e) {
+				const auto index = static_cast<std::size_t>(indices[e]);
+				auto* element = data + (i + e) * 8;
+				store<std::int16_t>(element, (index + 1) & 3, static_cast<std::int16_t>(components[0][e]));
+				store<std::int16_t>(element, (index + 2) & 3, static_cast<std::int16_t>(components[1][e]));
+				store<std::int16_t>(element, (index + 3) & 3, static_cast<std::int16_t>(components[2][e]));
+				store<std::int16_t>(element, index, static_cast<std::int16_t>(components[3][e]));
+			}
+		}
+		decodeFilterQuaternion(data, count, i);
+	}
+
+	[[gnu::target("sse4.1")]] void sse4_decode_filter_exponential(std::byte* data, std::size_t count) {
+		std::size_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			const auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 4));
+			const auto mantissa = _mm_srai_epi32(_mm_slli_epi32(value, 8), 8);
+			const auto exponent = _mm_srai_epi32(value, 24);
+
+			const auto power = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(exponent, _mm_set1_epi32(127)), 23));
+			_mm_storeu_ps(reinterpret_cast<float*>(data + i * 4), _mm_mul_ps(power, _mm_cvtepi32_ps(mantissa)));
+		}
+		decodeFilterExponential(data, count, i);
+	}
+} // namespace fastgltf::meshopt
+
+bool fg::meshopt::sse4_decode_vertex_buffer(std::byte* destination, std::size_t count, std::size_t byteStride, span<const std::byte> source) {
+	return decodeVertexBlocks(destination, count, byteStride, source, sse4_decode_vertex_block);
+}
+
+void fg::meshopt::sse4_decode_filter(MeshoptCompressionFilter filter, std::byte* data, std::size_t count, std::size_t byteStride) {
+	switch (filter) {
+		case MeshoptCompressionFilter::None:
+			break;
+		case MeshoptCompressionFilter::Octahedral:
+			if (byteStride == 4) {
+				sse4_decode_filter_octahedral8(data, count);
+			} else {
+				sse4_decode_filter_octahedral16(data, count);
+			}
+			break;
+		case MeshoptCompressionFilter::Quaternion:
+			sse4_decode_filter_quaternion(data, count);
+			break;
+		case MeshoptCompressionFilter::Exponential:
+			sse4_decode_filter_exponential(data, count * (byteStride / 4));
+			break;
+	}
+}
+#endif
+
+bool fg::meshopt::decodeVertexBuffer(std::byte* destination, std::size_t count, std::size_t byteStride, span<const std::byte> source) {
+	return DecodeFunctionGetter::get()->vertexBuffer(destination, count, byteStride, source);
+}
+
+bool fg::meshopt::decodeIndexBuffer(std::byte* destination, std::size_t count, std::size_t indexSize, span<const std::byte> source) {
+	if (count % 3 != 0 || (indexSize != 2 && indexSize != 4))
+		return false;
+
+	// The smallest valid encoding is the header, one code per triangle, and the 16-byte auxiliary code table.
+	const auto triangleCount = count / 3;
+	if (source.size() < 1 + triangleCount + 16)
+		return false;
+
+	const auto* bytes = reinterpret_cast<const std::uint8_t*>(source.data());
+	if ((bytes[0] & 0xF0) != indexHeader || (bytes[0] & 0x0F) > 1)
+		return false;
+	const auto version = bytes[0] & 0x0F;
+
+	// Recently seen edges and vertices, which the triangle codes refer to.
+	std::uint32_t edgeFifo[16][2];
+	std::uint32_t vertexFifo[16];
+	std::memset(edgeFifo, -1, sizeof edgeFifo);
+	std::memset(vertexFifo, -1, sizeof vertexFifo);
+	std::size_t edgeFifoOffset = 0;
+	std::size_t vertexFifoOffset = 0;
+
+	auto pushEdge = [&](std::uint32_t a, std::uint32_t b) {
+		edgeFifo[edgeFifoOffset][0] = a;
+		edgeFifo[edgeFifoOffset][1] = b;
+		edgeFifoOffset = (edgeFifoOffset + 1) & 15;
+	};
+	auto pushVertex = [&](std::uint32_t v, bool condition = true) {
+		vertexFifo[vertexFifoOffset] = v;
+		vertexFifoOffset = (vertexFifoOffset + condition) & 15;
+	};
+
+	std::uint32_t next = 0;
+	std::uint32_t last = 0;
+	// Version 1 additionally encodes a free vertex as a delta of -1 or 1 relative to the last one.
+	const unsigned fecMax = version >= 1 ? 13 : 15;
+
+	const auto* code = bytes + 1;
+	const auto* data = code + triangleCount;
+	const auto* dataSafeEnd = bytes + source.size() - 16;
+	const auto* codeAuxTable = dataSafeEnd;
+
+	for (std::size_t i = 0; i < count; i += 3) {
+		// A triangle reads at most 16 bytes of data, which the code table after the data guarantees to be readable.
+		if (data > dataSafeEnd)
+			return false;
+
+		const auto codeTri = *code++;
+		std::uint32_t a, b, c;
+		if (codeTri < 0xF0) {
+			// The triangle shares an edge from the edge FIFO.
+			const auto fe = codeTri >> 4;
+			a = edgeFifo[(edgeFifoOffset - 1 - fe) & 15][0];
+			b = edgeFifo[(edgeFifoOffset - 1 - fe) & 15][1];
+
+			const unsigned fec = codeTri & 15;
+			if (fec < fecMax) {
+				// The third vertex is either new, or from the vertex FIFO.
+				c = fec == 0 ? next : vertexFifo[(vertexFifoOffset - 1 - fec) & 15];
+				next += fec == 0;
+				pushVertex(c, fec == 0);
+			} else {
+				// The third vertex is encoded as a delta to the last encoded vertex.
+				last = c = fec != 15 ? last + (fec - (fec ^ 3)) : decodeIndex(data, last);
+				pushVertex(c);
+			}
+			pushEdge(c, b);
+			pushEdge(a, c);
+		} else {
+			if (codeTri < 0xFE) {
+				// The codes for the second and third vertices are stored in the table, the first vertex is always new.
+				const auto codeAux = codeAuxTable[codeTri & 15];
+				const unsigned feb = codeAux >> 4;
+				const unsigned fec = codeAux & 15;
+
+				a = next++;
+				b = feb == 0 ? next++ : vertexFifo[(vertexFifoOffset - feb) & 15];
+				c = fec == 0 ? next++ : vertexFifo[(vertexFifoOffset - fec) & 15];
+
+				pushVertex(a);
+				pushVertex(b, feb == 0);
+				pushVertex(c, fec == 0);
+			} else {
+				const auto codeAux = *data++;
+				const unsigned fea = codeTri == 0xFE ? 0 : 15;
+				const unsigned feb = codeAux >> 4;
+				const unsigned fec = codeAux & 15;
+
+				// A zero code that is not from the table restarts the numbering of new vertices.
+				if (codeAux == 0)
+					next = 0;
+
+				a = fea == 0 ? next++ : 0;
+				b = feb == 0 ? next++ : vertexFifo[(vertexFifoOffset - feb) & 15];
+				c = fec == 0 ? next++ : vertexFifo[(vertexFifoOffset - fec) & 15];
+
+				// Free vertices are encoded as a delta to the last encoded vertex.
+				if (fea == 15)
+					last = a = decodeIndex(data, last);
+				if (feb == 15)
+					last = b = decodeIndex(data, last);
+				if (fec == 15)
+					last = c = decodeIndex(data, last);
+
+				pushVertex(a);
+				pushVertex(b, feb == 0 || feb == 15);
+				pushVertex(c, fec == 0 || fec == 15);
+			}
+			pushEdge(b, a);
+			pushEdge(c, b);
+			pushEdge(a, c);
+		}
+
+		writeIndex(destination, i + 0, indexSize, a);
+		writeIndex(destination, i + 1, indexSize, b);
+		writeIndex(destination, i + 2, indexSize, c);
+	}
+
+	// All data should have been consumed, stopping right at the code table.
+	return data == dataSafeEnd;
+}
+
+bool fg::meshopt::decodeIndexSequence(std::byte* destination, std::size_t count, std::size_t indexSize, span<const std::byte> source) {
+	if (indexSize != 2 && indexSize != 4)
+		return false;
+
+	// The smallest valid encoding is the header, one byte per index, and a 4-byte tail.
+	if (source.size() < 1 + count + 4)
+		return false;
+
+	const auto* bytes = reinterpret_cast<const std::uint8_t*>(source.data());
+	if ((bytes[0] & 0xF0) != sequenceHeader || (bytes[0] & 0x0F) > 1)
+		return false;
+
+	const auto* data = bytes + 1;
+	const auto* dataSafeEnd = bytes + source.size() - 4;
+
+	// Every index is a delta to one of two baselines, the lowest bit selecting which one.
+	std::uint32_t last[2] = {};
+	for (std::size_t i = 0; i < count; ++i) {
+		// An index reads at most 5 bytes of data, which the tail guarantees to be readable.
+		if (data >= dataSafeEnd)
+			return false;
+
+		auto value = decodeVByte(data);
+		const auto baseline = value & 1;
+		value >>= 1;
+
+		const auto index = last[baseline] + ((value >> 1) ^ (0U - (value & 1)));
+		last[baseline] = index;
+		writeIndex(destination, i, indexSize, index);
+	}
+
+	return data == dataSafeEnd;
+}
+
+bool fg::meshopt::decodeFilter(MeshoptCompressionFilter filter, std::byte* data, std::size_t count, std::size_t byteStride) {
+	switch (filter) {
+		case MeshoptCompressionFilter::None:
+			return true;
+		case MeshoptCompressionFilter::Octahedral:
+			if (byteStride != 4 && byteStride != 8)
+				return false;
+			break;
+		case MeshoptCompressionFilter::Quaternion:
+			if (byteStride != 8)
+				return false;
+			break;
+		case MeshoptCompressionFilter::Exponential:
+			if (byteStride == 0 || byteStride % 4 != 0)
+				return false;
+			break;
+		default:
+			return false;
+	}
+
+	DecodeFunctionGetter::get()->filter(filter, data, count, byteStride);
+	return true;
+}
+
+bool fg::meshopt::decode(const CompressedBufferView& compression, span<const std::byte> source, std::byte* destination) {
+	switch (compression.mode) {
+		case MeshoptCompressionMode::Attributes:
+			return decodeVertexBuffer(destination, compression.count, compression.byteStride, source)
+				&& decodeFilter(compression.filter, destination, compression.count, compression.byteStride);
+		case MeshoptCompressionMode::Triangles:
+			// Filters can only be used with the attributes mode.
+			return compression.filter == MeshoptCompressionFilter::None
+				&& decodeIndexBuffer(destination, compression.count, compression.byteStride, source);
+		case MeshoptCompressionMode::Indices:
+			return compression.filter == MeshoptCompressionFilter::None
+				&& decodeIndexSequence(destination, compression.count, compression.byteStride, source);
+	}
+	return false;
+}
+
+bool fg::meshopt::isValidDecodedSize(const CompressedBufferView& compression, std::size_t byteLength) noexcept {
+	const auto stride = compression.byteStride;
+	if (compression.mode == MeshoptCompressionMode::Attributes) {
+		if (stride == 0 || stride % 4 != 0 || stride > 256)
+			return false;
+	} else if (stride != 2 && stride != 4) {
+		return false;
+	}
+
+	if (compression.count > std::numeric_limits<std::size_t>::max() / stride)
+		return false;
+	return compression.count * stride == byteLength;
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
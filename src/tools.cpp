@@ -0,0 +1,1582 @@
+/*
+ * Copyright (C) 2022 - 2024 spnda
+ * This file is part of fastgltf <https://github.com/spnda/fastgltf>.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#if !defined(__cplusplus) || (!defined(_MSVC_LANG) && __cplusplus < 201703L) || (defined(_MSVC_LANG) && _MSVC_LANG < 201703L)
+#error "fastgltf requires C++17"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "simdjson.h"
+
+#include <fastgltf/base64.hpp>
+#include <fastgltf/meshopt.hpp>
+#include <fastgltf/tools.hpp>
+
+#if defined(FASTGLTF_IS_X86)
+#if defined(__clang__) || defined(__GNUC__)
+// See base64.cpp on why these are included manually.
+#include <immintrin.h>
+#include <smmintrin.h>
+#include <avxintrin.h>
+#include <avx2intrin.h>
+#include <f16cintrin.h>
+#include <cpuid.h>
+#else
+#include <intrin.h>
+#endif
+#elif defined(FASTGLTF_IS_A64)
+#include <arm_neon.h> // Includes arm64_neon.h on MSVC
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 5030) // attribute 'x' is not recognized
+#pragma warning(disable : 4710) // function not inlined
+#endif
+
+namespace fg = fastgltf;
+
+namespace fastgltf::internal {
+	using ConvertToFloatFunction = void(*)(const std::byte*, float*, std::size_t, ComponentType, bool);
+	using WidenIndicesFunction = void(*)(const std::byte*, std::uint32_t*, std::size_t, ComponentType);
+	using ConvertToHalfFunction = void(*)(const float*, std::uint16_t*, std::size_t);
+	using MultiplyAddFunction = void(*)(const float*, float*, std::size_t, float);
+
+#if defined(FASTGLTF_IS_X86)
+	// simdjson's haswell implementation does not require F16C, which is why it is checked separately.
+	// CPUID leaf 1 reports F16C support in bit 29 of ECX.
+	[[nodiscard]] static bool isF16CSupported() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+		__cpuid(info, 1);
+		return (info[2] & (1 << 29)) != 0;
+#else
+		unsigned int eax, ebx, ecx, edx;
+		return __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & (1U << 29)) != 0;
+#endif
+	}
+#endif
+
+	struct ConversionFunctionGetter {
+		ConvertToFloatFunction toFloat = fallback_convert_to_float;
+		WidenIndicesFunction widen = fallback_widen_indices;
+		ConvertToHalfFunction toHalf = fallback_convert_to_half;
+		MultiplyAddFunction multiplyAdd = fallback_multiply_add;
+
+		explicit ConversionFunctionGetter() {
+			// Same as with the base64 decoders, we use simdjson to determine the supported instruction sets.
+			const auto& impls = simdjson::get_available_implementations();
+#if defined(FASTGLTF_IS_X86)
+			if (const auto* avx2 = impls["haswell"]; avx2 != nullptr && avx2->supported_by_runtime_system()) {
+				toFloat = avx2_convert_to_float;
+				widen = avx2_widen_indices;
+				multiplyAdd = avx2_multiply_add;
+				if (isF16CSupported())
+					toHalf = avx2_convert_to_half;
+			} else if (const auto* sse4 = impls["westmere"]; sse4 != nullptr && sse4->supported_by_runtime_system()) {
+				toFloat = sse4_convert_to_float;
+				widen = sse4_widen_indices;
+				multiplyAdd = sse4_multiply_add;
+			}
+#elif defined(FASTGLTF_IS_A64)
+			if (const auto* neon = impls["arm64"]; neon && neon->supported_by_runtime_system()) {
+				toFloat = neon_convert_to_float;
+				widen = neon_widen_indices;
+				toHalf = neon_convert_to_half;
+				multiplyAdd = neon_multiply_add;
+			}
+#else
+			(void)impls;
+#endif
+		}
+
+		static ConversionFunctionGetter* get() {
+			static ConversionFunctionGetter getter;
+			return &getter;
+		}
+	};
+
+	template <typename T, bool Normalized>
+	void convertToFloatScalar(const std::byte* src, float* dst, std::size_t count) {
+		for (std::size_t i = 0; i < count; ++i) {
+			dst[i] = convertComponent<float>(deserializeComponent<T>(src, i), Normalized);
+		}
+	}
+
+	template <bool Normalized>
+	void convertToFloatScalar(const std::byte* src, float* dst, std::size_t count, ComponentType componentType) {
+		switch (componentType) {
+			case ComponentType::Byte:
+				return convertToFloatScalar<std::int8_t, Normalized>(src, dst, count);
+			case ComponentType::UnsignedByte:
+				return convertToFloatScalar<std::uint8_t, Normalized>(src, dst, count);
+			case ComponentType::Short:
+				return convertToFloatScalar<std::int16_t, Normalized>(src, dst, count);
+			case ComponentType::UnsignedShort:
+				return convertToFloatScalar<std::uint16_t, Normalized>(src, dst, count);
+			default:
+				assert(false && "Only 8-bit and 16-bit components can be batch converted");
+		}
+	}
+
+	/** Returns the value that convertComponent divides normalized integers of the given type by. */
+	float getNormalizationDivisor(ComponentType componentType) {
+		switch (componentType) {
+			case ComponentType::Byte:
+				return static_cast<float>(std::numeric_limits<std::int8_t>::max());
+			case ComponentType::UnsignedByte:
+				return static_cast<float>(std::numeric_limits<std::uint8_t>::max());
+			case ComponentType::Short:
+				return static_cast<float>(std::numeric_limits<std::int16_t>::max());
+			case ComponentType::UnsignedShort:
+				return static_cast<float>(std::numeric_limits<std::uint16_t>::max());
+			default:
+				return 1.0f;
+		}
+	}
+
+	/**
+	 * Converts a single float to a half using only integer arithmetic, rounding to nearest even.
+	 * This is based on https://gist.github.com/rygorous/2156668, but preserves NaN payloads like F16C does.
+	 */
+	std::uint16_t convertToHalfScalar(float value) {
+		constexpr std::uint32_t f32Infinity = 255U << 23;
+		constexpr std::uint32_t f16Max = (127U + 16U) << 23;
+		constexpr std::uint32_t denormMagic = ((127U - 15U) + (23U - 10U) + 1U) << 23;
+
+		auto bits = bit_cast<std::uint32_t>(value);
+		const auto sign = static_cast<std::uint16_t>((bits & 0x80000000U) >> 16);
+		bits &= 0x7FFFFFFFU;
+
+		std::uint16_t result;
+		if (bits >= f16Max) {
+			// Inf or NaN. NaNs are made quiet and keep the upper bits of their payload.
+			result = bits > f32Infinity ? static_cast<std::uint16_t>(0x7E00U | ((bits >> 13) & 0x3FFU)) : 0x7C00U;
+		} else if (bits < (113U << 23)) {
+			// The result is a subnormal half or zero. Adding the magic number makes the FPU do the rounding.
+			auto magic = bit_cast<float>(bits) + bit_cast<float>(denormMagic);
+			result = static_cast<std::uint16_t>(bit_cast<std::uint32_t>(magic) - denormMagic);
+		} else {
+			const auto mantissaOdd = (bits >> 13) & 1U;
+			// Rebias the exponent and round, where carries into the exponent are the correct result.
+			bits += ((15U - 127U) << 23) + 0xFFFU + mantissaOdd;
+			result = static_cast<std::uint16_t>(bits >> 13);
+		}
+		return static_cast<std::uint16_t>(result | sign);
+	}
+} // namespace fastgltf::internal
+
+void fg::internal::fallback_convert_to_float(const std::byte* src, float* dst, std::size_t count, ComponentType componentType, bool normalized) {
+	if (normalized) {
+		convertToFloatScalar<true>(src, dst, count, componentType);
+	} else {
+		convertToFloatScalar<false>(src, dst, count, componentType);
+	}
+}
+
+void fg::internal::fallback_widen_indices(const std::byte* src, std::uint32_t* dst, std::size_t count, ComponentType componentType) {
+	if (componentType == ComponentType::UnsignedByte) {
+		for (std::size_t i = 0; i < count; ++i) {
+			dst[i] = deserializeComponent<std::uint8_t>(src, i);
+		}
+	} else {
+		assert(componentType == ComponentType::UnsignedShort);
+		for (std::size_t i = 0; i < count; ++i) {
+			dst[i] = deserializeComponent<std::uint16_t>(src, i);
+		}
+	}
+}
+
+void fg::internal::fallback_convert_to_half(const float* src, std::uint16_t* dst, std::size_t count) {
+	for (std::size_t i = 0; i < count; ++i) {
+		dst[i] = convertToHalfScalar(src[i]);
+	}
+}
+
+void fg::internal::fallback_multiply_add(const float* src, float* dst, std::size_t count, float weight) {
+	for (std::size_t i = 0; i < count; ++i) {
+		dst[i] += weight * src[i];
+	}
+}
+
+#if defined(FASTGLTF_IS_X86)
+// The normalized conversions divide instead of multiplying by the reciprocal, to give the exact same
+// results as convertComponent. The max with -1 is a no-op for unsigned types.
+[[gnu::target("sse4.1")]] FASTGLTF_FORCEINLINE __m128 sse4_normalize(__m128i input, __m128 divisor, bool normalized) {
+	auto floats = _mm_cvtepi32_ps(input);
+	if (normalized) {
+		floats = _mm_max_ps(_mm_div_ps(floats, divisor), _mm_set1_ps(-1.0f));
+	}
+	return floats;
+}
+
+[[gnu::target("sse4.1")]] void fg::internal::sse4_convert_to_float(const std::byte* src, float* dst, std::size_t count, ComponentType componentType, bool normalized) {
+	const auto divisor = _mm_set1_ps(getNormalizationDivisor(componentType));
+
+	std::size_t pos = 0;
+	switch (componentType) {
+		case ComponentType::Byte:
+		case ComponentType::UnsignedByte: {
+			const bool isSigned = componentType == ComponentType::Byte;
+			for (; pos + 16 <= count; pos += 16) {
+				const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+				// The conversion instructions only extend the lowest four bytes.
+				const __m128i parts[] = {
+					input, _mm_srli_si128(input, 4), _mm_srli_si128(input, 8), _mm_srli_si128(input, 12),
+				};
+				for (std::size_t i = 0; i < 4; ++i) {
+					const auto ints = isSigned ? _mm_cvtepi8_epi32(parts[i]) : _mm_cvtepu8_epi32(parts[i]);
+					_mm_storeu_ps(dst + pos + i * 4, sse4_normalize(ints, divisor, normalized));
+				}
+			}
+			break;
+		}
+		case ComponentType::Short:
+		case ComponentType::UnsignedShort: {
+			const bool isSigned = componentType == ComponentType::Short;
+			for (; pos + 8 <= count; pos += 8) {
+				const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos * 2));
+				const __m128i parts[] = { input, _mm_srli_si128(input, 8) };
+				for (std::size_t i = 0; i < 2; ++i) {
+					const auto ints = isSigned ? _mm_cvtepi16_epi32(parts[i]) : _mm_cvtepu16_epi32(parts[i]);
+					_mm_storeu_ps(dst + pos + i * 4, sse4_normalize(ints, divisor, normalized));
+				}
+			}
+			break;
+		}
+		default:
+			break;
+	}
+
+	const auto componentSize = getComponentByteSize(componentType);
+	fallback_convert_to_float(src + pos * componentSize, dst + pos, count - pos, componentType, normalized);
+}
+
+[[gnu::target("avx2")]] FASTGLTF_FORCEINLINE __m256 avx2_normalize(__m256i input, __m256 divisor, bool normalized) {
+	auto floats = _mm256_cvtepi32_ps(input);
+	if (normalized) {
+		floats = _mm256_max_ps(_mm256_div_ps(floats, divisor), _mm256_set1_ps(-1.0f));
+	}
+	return floats;
+}
+
+[[gnu::target("avx2")]] void fg::internal::avx2_convert_to_float(const std::byte* src, float* dst, std::size_t count, ComponentType componentType, bool normalized) {
+	const auto divisor = _mm256_set1_ps(getNormalizationDivisor(componentType));
+
+	std::size_t pos = 0;
+	switch (componentType) {
+		case ComponentType::Byte:
+		case ComponentType::UnsignedByte: {
+			const bool isSigned = componentType == ComponentType::Byte;
+			for (; pos + 16 <= count; pos += 16) {
+				const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+				const __m128i parts[] = { input, _mm_srli_si128(input, 8) };
+				for (std::size_t i = 0; i < 2; ++i) {
+					const auto ints = isSigned ? _mm256_cvtepi8_epi32(parts[i]) : _mm256_cvtepu8_epi32(parts[i]);
+					_mm256_storeu_ps(dst + pos + i * 8, avx2_normalize(ints, divisor, normalized));
+				}
+			}
+			break;
+		}
+		case ComponentType::Short:
+		case ComponentType::UnsignedShort: {
+			const bool isSigned = componentType == ComponentType::Short;
+			for (; pos + 8 <= count; pos += 8) {
+				const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos * 2));
+				const auto ints = isSigned ? _mm256_cvtepi16_epi32(input) : _mm256_cvtepu16_epi32(input);
+				_mm256_storeu_ps(dst + pos, avx2_normalize(ints, divisor, normalized));
+			}
+			break;
+		}
+		default:
+			break;
+	}
+
+	const auto componentSize = getComponentByteSize(componentType);
+	fallback_convert_to_float(src + pos * componentSize, dst + pos, count - pos, componentType, normalized);
+}
+
+[[gnu::target("sse4.1")]] void fg::internal::sse4_widen_indices(const std::byte* src, std::uint32_t* dst, std::size_t count, ComponentType componentType) {
+	std::size_t pos = 0;
+	if (componentType == ComponentType::UnsignedByte) {
+		for (; pos + 16 <= count; pos += 16) {
+			const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+			auto* output = reinterpret_cast<__m128i*>(dst + pos);
+			_mm_storeu_si128(output + 0, _mm_cvtepu8_epi32(input));
+			_mm_storeu_si128(output + 1, _mm_cvtepu8_epi32(_mm_srli_si128(input, 4)));
+			_mm_storeu_si128(output + 2, _mm_cvtepu8_epi32(_mm_srli_si128(input, 8)));
+			_mm_storeu_si128(output + 3, _mm_cvtepu8_epi32(_mm_srli_si128(input, 12)));
+		}
+	} else {
+		for (; pos + 8 <= count; pos += 8) {
+			const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos * 2));
+			auto* output = reinterpret_cast<__m128i*>(dst + pos);
+			_mm_storeu_si128(output + 0, _mm_cvtepu16_epi32(input));
+			_mm_storeu_si128(output + 1, _mm_cvtepu16_epi32(_mm_srli_si128(input, 8)));
+		}
+	}
+
+	const auto componentSize = getComponentByteSize(componentType);
+	fallback_widen_indices(src + pos * componentSize, dst + pos, count - pos, componentType);
+}
+
+[[gnu::target("avx2")]] void fg::internal::avx2_widen_indices(const std::byte* src, std::uint32_t* dst, std::size_t count, ComponentType componentType) {
+	std::size_t pos = 0;
+	if (componentType == ComponentType::UnsignedByte) {
+		for (; pos + 16 <= count; pos += 16) {
+			const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+			auto* output = reinterpret_cast<__m256i*>(dst + pos);
+			_mm256_storeu_si256(output + 0, _mm256_cvtepu8_epi32(input));
+			_mm256_storeu_si256(output + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(input, 8)));
+		}
+	} else {
+		for (; pos + 16 <= count; pos += 16) {
+			const auto* input = reinterpret_cast<const __m128i*>(src + pos * 2);
+			auto* output = reinterpret_cast<__m256i*>(dst + pos);
+			_mm256_storeu_si256(output + 0, _mm256_cvtepu16_epi32(_mm_loadu_si128(input + 0)));
+			_mm256_storeu_si256(output + 1, _mm256_cvtepu16_epi32(_mm_loadu_si128(input + 1)));
+		}
+	}
+
+	const auto componentSize = getComponentByteSize(componentType);
+	fallback_widen_indices(src + pos * componentSize, dst + pos, count - pos, componentType);
+}
+
+[[gnu::target("avx2,f16c")]] void fg::internal::avx2_convert_to_half(const float* src, std::uint16_t* dst, std::size_t count) {
+	std::size_t pos = 0;
+	for (; pos + 8 <= count; pos += 8) {
+		const auto halves = _mm256_cvtps_ph(_mm256_loadu_ps(src + pos), _MM_FROUND_TO_NEAREST_INT);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + pos), halves);
+	}
+
+	fallback_convert_to_half(src + pos, dst + pos, count - pos);
+}
+
+[[gnu::target("sse4.1")]] void fg::internal::sse4_multiply_add(const float* src, float* dst, std::size_t count, float weight) {
+	const auto weights = _mm_set1_ps(weight);
+	std::size_t pos = 0;
+	for (; pos + 4 <= count; pos += 4) {
+		const auto product = _mm_mul_ps(_mm_loadu_ps(src + pos), weights);
+		_mm_storeu_ps(dst + pos, _mm_add_ps(_mm_loadu_ps(dst + pos), product));
+	}
+
+	fallback_multiply_add(src + pos, dst + pos, count - pos, weight);
+}
+
+[[gnu::target("avx2")]] void fg::internal::avx2_multiply_add(const float* src, float* dst, std::size_t count, float weight) {
+	// A separate multiply and add instead of FMA, so that the result is rounded the same as by the other kernels.
+	const auto weights = _mm256_set1_ps(weight);
+	std::size_t pos = 0;
+	for (; pos + 16 <= count; pos += 16) {
+		const auto product0 = _mm256_mul_ps(_mm256_loadu_ps(src + pos), weights);
+		const auto product1 = _mm256_mul_ps(_mm256_loadu_ps(src + pos + 8), weights);
+		_mm256_storeu_ps(dst + pos, _mm256_add_ps(_mm256_loadu_ps(dst + pos), product0));
+		_mm256_storeu_ps(dst + pos + 8, _mm256_add_ps(_mm256_loadu_ps(dst + pos + 8), product1));
+	}
+	for (; pos + 8 <= count; pos += 8) {
+		const auto product = _mm256_mul_ps(_mm256_loadu_ps(src + pos), weights);
+		_mm256_storeu_ps(dst + pos, _mm256_add_ps(_mm256_loadu_ps(dst + pos), product));
+	}
+
+	fallback_multiply_add(src + pos, dst + pos, count - pos, weight);
+}
+#elif defined(FASTGLTF_IS_A64)
+FASTGLTF_FORCEINLINE float32x4_t neon_normalize(float32x4_t input, float32x4_t divisor, bool normalized) {
+	if (normalized) {
+		return vmaxq_f32(vdivq_f32(input, divisor), vdupq_n_f32(-1.0f));
+	}
+	return input;
+}
+
+void fg::internal::neon_convert_to_float(const std::byte* src, float* dst, std::size_t count, ComponentType componentType, bool normalized) {
+	const auto divisor = vdupq_n_f32(getNormalizationDivisor(componentType));
+	const auto* bytes = reinterpret_cast<const std::uint8_t*>(src);
+
+	std::size_t pos = 0;
+	switch (componentType) {
+		case ComponentType::Byte:
+		case ComponentType::UnsignedByte:
+			for (; pos + 8 <= count; pos += 8) {
+				float32x4_t floats[2];
+				if (componentType == ComponentType::Byte) {
+					const auto shorts = vmovl_s8(vld1_s8(reinterpret_cast<const std::int8_t*>(bytes + pos)));
+					floats[0] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(shorts)));
+					floats[1] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(shorts)));
+				} else {
+					const auto shorts = vmovl_u8(vld1_u8(bytes + pos));
+					floats[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(shorts)));
+					floats[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(shorts)));
+				}
+				vst1q_f32(dst + pos, neon_normalize(floats[0], divisor, normalized));
+				vst1q_f32(dst + pos + 4, neon_normalize(floats[1], divisor, normalized));
+			}
+			break;
+		case ComponentType::Short:
+		case ComponentType::UnsignedShort:
+			for (; pos + 8 <= count; pos += 8) {
+				float32x4_t floats[2];
+				if (componentType == ComponentType::Short) {
+					const auto shorts = vld1q_s16(reinterpret_cast<const std::int16_t*>(bytes + pos * 2));
+					floats[0] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(shorts)));
+					floats[1] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(shorts)));
+				} else {
+					const auto shorts = vld1q_u16(reinterpret_cast<const std::uint16_t*>(bytes + pos * 2));
+					floats[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(shorts)));
+					floats[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(shorts)));
+				}
+				vst1q_f32(dst + pos, neon_normalize(floats[0], divisor, normalized));
+				vst1q_f32(dst + pos + 4, neon_normalize(floats[1], divisor, normalized));
+			}
+			break;
+		default:
+			break;
+	}
+
+	const auto componentSize = getComponentByteSize(componentType);
+	fallback_convert_to_float(src + pos * componentSize, dst + pos, count - pos, componentType, normalized);
+}
+
+void fg::internal::neon_widen_indices(const std::byte* src, std::uint32_t* dst, std::size_t count, ComponentType componentType) {
+	const auto* bytes = reinterpret_cast<const std::uint8_t*>(src);
+
+	std::size_t pos = 0;
+	if (componentType == ComponentType::UnsignedByte) {
+		for (; pos + 8 <= count; pos += 8) {
+			const auto shorts = vmovl_u8(vld1_u8(bytes + pos));
+			vst1q_u32(dst + pos, vmovl_u16(vget_low_u16(shorts)));
+			vst1q_u32(dst + pos + 4, vmovl_u16(vget_high_u16(shorts)));
+		}
+	} else {
+		for (; pos + 8 <= count; pos += 8) {
+			const auto shorts = vld1q_u16(reinterpret_cast<const std::uint16_t*>(bytes + pos * 2));
+			vst1q_u32(dst + pos, vmovl_u16(vget_low_u16(shorts)));
+			vst1q_u32(dst + pos + 4, vmovl_u16(vget_high_u16(shorts)));
+		}
+	}
+
+	const auto componentSize = getComponentByteSize(componentType);
+	fallback_widen_indices(src + pos * componentSize, dst + pos, count - pos, componentType);
+}
+
+void fg::internal::neon_convert_to_half(const float* src, std::uint16_t* dst, std::size_t count) {
+	std::size_t pos = 0;
+	for (; pos + 4 <= count; pos += 4) {
+		vst1_u16(dst + pos, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + pos))));
+	}
+
+	fallback_convert_to_half(src + pos, dst + pos, count - pos);
+}
+
+void fg::internal::neon_multiply_add(const float* src, float* dst, std::size_t count, float weight) {
+	std::size_t pos = 0;
+	for (; pos + 4 <= count; pos += 4) {
+		vst1q_f32(dst + pos, vaddq_f32(vld1q_f32(dst + pos), vmulq_n_f32(vld1q_f32(src + pos), weight)));
+	}
+
+	fallback_multiply_add(src + pos, dst + pos, count - pos, weight);
+}
+#endif
+
+namespace fastgltf::internal {
+	/** The amount of elements gathered into a packed block before being converted. */
+	static constexpr std::size_t conversionBlockSize = 256;
+
+	/**
+	 * Runs the given packed kernel over strided elements. Packed data is converted in one go, while
+	 * strided data is gathered and scattered in blocks around the kernel.
+	 */
+	template <typename Dest, typename Kernel>
+	void convertStrided(const std::byte* src, std::size_t srcStride, std::byte* dst, std::size_t dstStride,
+			std::size_t componentCount, std::size_t count, ComponentType componentType, Kernel&& kernel) {
+		const auto srcElemSize = componentCount * getComponentByteSize(componentType);
+		const auto dstElemSize = componentCount * sizeof(Dest);
+		const bool srcPacked = srcStride == srcElemSize;
+		const bool dstPacked = dstStride == dstElemSize;
+
+		if (srcPacked && dstPacked && reinterpret_cast<std::uintptr_t>(dst) % alignof(Dest) == 0) {
+			kernel(src, reinterpret_cast<Dest*>(dst), count * componentCount);
+			return;
+		}
+
+		// Non-matrix accessors have at most four 16-bit components per element.
+		std::array<std::byte, conversionBlockSize * 4 * sizeof(std::uint16_t)> packedSource;
+		std::array<Dest, conversionBlockSize * 4> packedDest;
+		assert(componentCount <= 4);
+
+		for (std::size_t block = 0; block < count; block += conversionBlockSize) {
+			const auto blockCount = min(conversionBlockSize, count - block);
+			const auto* blockSrc = src + srcStride * block;
+			auto* blockDst = dst + dstStride * block;
+
+			if (!srcPacked) {
+				copyStridedElements(blockSrc, srcStride, packedSource.data(), srcElemSize, srcElemSize, blockCount);
+				blockSrc = packedSource.data();
+			}
+
+			kernel(blockSrc, packedDest.data(), blockCount * componentCount);
+			copyStridedElements(reinterpret_cast<const std::byte*>(packedDest.data()), dstElemSize,
+								blockDst, dstStride, dstElemSize, blockCount);
+		}
+	}
+} // namespace fastgltf::internal
+
+void fg::internal::convertComponentsToFloat(const std::byte* src, std::size_t srcStride, std::byte* dst, std::size_t dstStride,
+		std::size_t componentCount, std::size_t count, ComponentType componentType, bool normalized) {
+	assert(isBatchConvertible(componentType));
+	const auto toFloat = ConversionFunctionGetter::get()->toFloat;
+	convertStrided<float>(src, srcStride, dst, dstStride, componentCount, count, componentType,
+		[&](const std::byte* blockSrc, float* blockDst, std::size_t blockCount) {
+			toFloat(blockSrc, blockDst, blockCount, componentType, normalized);
+		});
+}
+
+void fg::internal::widenComponents(const std::byte* src, std::size_t srcStride, std::byte* dst, std::size_t dstStride,
+		std::size_t componentCount, std::size_t count, ComponentType componentType) {
+	assert(componentType == ComponentType::UnsignedByte || componentType == ComponentType::UnsignedShort);
+	const auto widen = ConversionFunctionGetter::get()->widen;
+	convertStrided<std::uint32_t>(src, srcStride, dst, dstStride, componentCount, count, componentType,
+		[&](const std::byte* blockSrc, std::uint32_t* blockDst, std::size_t blockCount) {
+			widen(blockSrc, blockDst, blockCount, componentType);
+		});
+}
+
+void fg::convertToHalf(const float* src, std::uint16_t* dst, std::size_t count) {
+	internal::ConversionFunctionGetter::get()->toHalf(src, dst, count);
+}
+
+namespace fastgltf::internal {
+	/** Converts count strided VEC3 elements of any component type to tightly packed floats. */
+	void convertVec3ToFloat(const std::byte* src, std::size_t srcStride, float* dst, std::size_t count,
+			ComponentType componentType, bool normalized) {
+		if (componentType == ComponentType::Float && srcStride == sizeof(math::fvec3)) {
+			std::memcpy(dst, src, count * sizeof(math::fvec3));
+		} else if (isBatchConvertible(componentType)) {
+			convertComponentsToFloat(src, srcStride, reinterpret_cast<std::byte*>(dst), sizeof(math::fvec3), 3, count,
+				componentType, normalized);
+		} else {
+			readAccessorElements<math::fvec3>(componentType, normalized, src, srcStride, count,
+				[&](const math::fvec3& value, std::size_t i) {
+					std::memcpy(dst + i * 3, value.data(), sizeof(math::fvec3));
+				});
+		}
+	}
+} // namespace fastgltf::internal
+
+void fg::internal::blendMorphTargets(const MorphTargetData* targets, std::size_t targetCount, math::fvec3* destination, std::size_t count) {
+	static_assert(sizeof(math::fvec3) == 3 * sizeof(float));
+	const auto multiplyAdd = ConversionFunctionGetter::get()->multiplyAdd;
+	auto* dst = reinterpret_cast<float*>(destination);
+	std::array<float, conversionBlockSize * 3> values;
+
+	// All dense targets are added to one block of vertices after another, so that every block of the
+	// destination stays in the cache until all targets have been added to it.
+	for (std::size_t block = 0; block < count; block += conversionBlockSize) {
+		const auto blockCount = min(conversionBlockSize, count - block);
+		for (std::size_t i = 0; i < targetCount; ++i) {
+			const auto& target = targets[i];
+			if (target.data == nullptr || block >= target.count)
+				continue;
+
+			const auto elementCount = min(blockCount, target.count - block);
+			const auto* src = target.data + target.byteStride * block;
+			if (target.componentType == ComponentType::Float && target.byteStride == sizeof(math::fvec3)) {
+				multiplyAdd(reinterpret_cast<const float*>(src), dst + block * 3, elementCount * 3, target.weight);
+			} else {
+				convertVec3ToFloat(src, target.byteStride, values.data(), elementCount, target.componentType, target.normalized);
+				multiplyAdd(values.data(), dst + block * 3, elementCount * 3, target.weight);
+			}
+		}
+	}
+
+	// Sparse values replace the dense displacement at their index, which therefore has to be subtracted again.
+	std::array<std::uint32_t, conversionBlockSize> indices;
+	for (std::size_t i = 0; i < targetCount; ++i) {
+		const auto& target = targets[i];
+		const auto indexStride = getComponentByteSize(target.sparseIndexComponentType);
+		const auto valueStride = 3 * getComponentByteSize(target.componentType);
+		for (std::size_t block = 0; block < target.sparseCount; block += conversionBlockSize) {
+			const auto blockCount = min(conversionBlockSize, target.sparseCount - block);
+
+			const auto* blockIndices = target.sparseIndices + indexStride * block;
+			if (target.sparseIndexComponentType == ComponentType::UnsignedInt) {
+				std::memcpy(indices.data(), blockIndices, blockCount * sizeof(std::uint32_t));
+			} else if (target.sparseIndexComponentType == ComponentType::UnsignedByte
+					|| target.sparseIndexComponentType == ComponentType::UnsignedShort) {
+				widenComponents(blockIndices, indexStride, reinterpret_cast<std::byte*>(indices.data()), sizeof(std::uint32_t),
+					1, blockCount, target.sparseIndexComponentType);
+			} else {
+				for (std::size_t j = 0; j < blockCount; ++j)
+					indices[j] = getAccessorElementAt<std::uint32_t>(target.sparseIndexComponentType, blockIndices + indexStride * j);
+			}
+			convertVec3ToFloat(target.sparseValues + valueStride * block, valueStride, values.data(), blockCount,
+				target.componentType, target.normalized);
+
+			for (std::size_t j = 0; j < blockCount; ++j) {
+				const auto index = indices[j];
+				if (index >= target.count)
+					continue;
+
+				auto value = math::fvec3(values[j * 3 + 0], values[j * 3 + 1], values[j * 3 + 2]);
+				if (target.data != nullptr) {
+					value -= getAccessorElementAt<math::fvec3>(target.componentType, target.data + target.byteStride * index,
+						target.normalized);
+				}
+				for (std::size_t c = 0; c < 3; ++c)
+					dst[index * 3 + c] += target.weight * value[c];
+			}
+		}
+	}
+}
+
+struct fg::CachingBufferDataAdapter::Cache {
+	using Bytes = CachingBufferDataAdapter::Bytes;
+	using Data = std::shared_ptr<const StaticVector<std::byte>>;
+
+	struct Entry {
+		std::uint64_t key;
+		Data data;
+	};
+
+	std::filesystem::path directory;
+	std::filesystem::path glbPath;
+	std::size_t memoryBudget;
+
+	std::mutex mutex;
+	// The front of the list is the most recently used entry.
+	std::list<Entry> entries;
+	std::unordered_map<std::uint64_t, std::list<Entry>::iterator> lookup;
+	std::size_t memoryUsage = 0;
+
+	// Buffer views and whole buffers share the cache, distinguished by the lowest bit of the key.
+	static constexpr std::uint64_t bufferViewKey(std::size_t index) noexcept {
+		return static_cast<std::uint64_t>(index) << 1;
+	}
+	static constexpr std::uint64_t bufferKey(std::size_t index) noexcept {
+		return (static_cast<std::uint64_t>(index) << 1) | 1;
+	}
+
+	static Bytes toBytes(Data data) noexcept {
+		const span<const std::byte> bytes(data->data(), data->size());
+		return Bytes(bytes, std::move(data));
+	}
+
+	Bytes find(std::uint64_t key) {
+		std::lock_guard lock(mutex);
+		auto it = lookup.find(key);
+		if (it == lookup.end())
+			return {};
+
+		entries.splice(entries.begin(), entries, it->second);
+		return toBytes(it->second->data);
+	}
+
+	/**
+	 * Adds the data to the cache, evicting the least recently used entries to stay within the budget.
+	 * Evicted data is only freed once no Bytes referencing it are left.
+	 */
+	Bytes insert(std::uint64_t key, StaticVector<std::byte>&& decoded) {
+		auto data = std::make_shared<const StaticVector<std::byte>>(std::move(decoded));
+
+		// Caching data larger than the budget would evict everything else, only for it to be evicted by the next insertion.
+		if (data->size() > memoryBudget)
+			return toBytes(std::move(data));
+
+		std::lock_guard lock(mutex);
+
+		// Another thread might have decoded the same data in the meantime, in which case we use theirs.
+		if (auto it = lookup.find(key); it != lookup.end()) {
+			entries.splice(entries.begin(), entries, it->second);
+			return toBytes(it->second->data);
+		}
+
+		memoryUsage += data->size();
+		entries.push_front(Entry { key, data });
+		lookup.emplace(key, entries.begin());
+
+		while (memoryUsage > memoryBudget) {
+			auto& last = entries.back();
+			memoryUsage -= last.data->size();
+			lookup.erase(last.key);
+			entries.pop_back();
+		}
+		return toBytes(std::move(data));
+	}
+
+	/** Returns the path of the file a sources::URI refers to, where an empty URI refers to the GLB file. */
+	std::filesystem::path getFilePath(const sources::URI& uri) const {
+		if (uri.uri.string().empty())
+			return glbPath;
+		return directory / uri.uri.fspath();
+	}
+
+	static bool readFile(const std::filesystem::path& path, std::size_t offset, span<std::byte> destination) {
+		std::ifstream file(path, std::ios::binary);
+		if (!file.is_open())
+			return false;
+
+		file.seekg(static_cast<std::streamoff>(offset));
+		file.read(reinterpret_cast<char*>(destination.data()), static_cast<std::streamsize>(destination.size()));
+		return file.gcount() == static_cast<std::streamsize>(destination.size());
+	}
+
+	Bytes getDataUriBuffer(const sources::URI& uri, std::size_t bufferIdx) {
+		if (auto data = find(bufferKey(bufferIdx)); data.data() != nullptr)
+			return data;
+
+		const auto path = uri.uri.path();
+		const auto encodingEnd = path.find(',');
+		if (encodingEnd == std::string_view::npos || path.substr(0, encodingEnd).find(";base64") == std::string_view::npos)
+			return {};
+
+		const auto encoded = path.substr(encodingEnd + 1);
+		if (encoded.size() % 4 != 0)
+			return {};
+
+		const auto padding = base64::getPadding(encoded);
+		StaticVector<std::byte> decoded(base64::getOutputSize(encoded.size(), padding));
+		base64::decode_inplace(encoded, reinterpret_cast<std::uint8_t*>(decoded.data()), padding);
+		return insert(bufferKey(bufferIdx), std::move(decoded));
+	}
+
+	/**
+	 * Returns the given range of a buffer, if it is in memory or a data URI. Otherwise, the range is
+	 * read from the file into fileData, if it is not nullptr.
+	 */
+	Bytes getBufferRange(const Asset& asset, std::size_t bufferIdx, std::size_t byteOffset, std::size_t byteLength,
+			StaticVector<std::byte>* fileData) {
+		if (bufferIdx >= asset.buffers.size())
+			return {};
+
+		// Data that is already in memory is owned by the asset, and is therefore returned without an owner.
+		auto data = std::visit(visitor {
+			[](auto&) -> Bytes {
+				return {};
+			},
+			[&](const sources::URI& uri) -> Bytes {
+				if (uri.uri.isDataUri())
+					return getDataUriBuffer(uri, bufferIdx);
+				if (fileData == nullptr)
+					return {};
+
+				*fileData = StaticVector<std::byte>(byteLength);
+				if (!readFile(getFilePath(uri), uri.fileByteOffset + byteOffset, span<std::byte>(fileData->data(), byteLength)))
+					return {};
+				return Bytes(span<const std::byte>(fileData->data(), byteLength), nullptr);
+			},
+			[](const sources::Array& array) -> Bytes {
+				return Bytes(span(reinterpret_cast<const std::byte*>(array.bytes.data()), array.bytes.size_bytes()), nullptr);
+			},
+			[](const sources::Vector& vec) -> Bytes {
+				return Bytes(span(reinterpret_cast<const std::byte*>(vec.bytes.data()), vec.bytes.size()), nullptr);
+			},
+			[](const sources::ByteView& bv) -> Bytes {
+				return Bytes(bv.bytes, nullptr);
+			},
+		}, asset.buffers[bufferIdx].data);
+
+		// A range read from a file only holds the requested range.
+		if (fileData != nullptr && data.data() == fileData->data())
+			return data;
+		if (data.data() == nullptr || byteOffset > data.size() || byteLength > data.size() - byteOffset)
+			return {};
+		return data.subspan(byteOffset, byteLength);
+	}
+
+	Bytes getBufferView(const Asset& asset, std::size_t bufferViewIdx) {
+		const auto& bufferView = asset.bufferViews[bufferViewIdx];
+		if (!bufferView.meshoptCompression) {
+			// Buffer views in memory are returned directly, which does not require locking.
+			if (auto data = getBufferRange(asset, bufferView.bufferIndex, bufferView.byteOffset, bufferView.byteLength, nullptr);
+					data.data() != nullptr)
+				return data;
+		}
+
+		if (auto data = find(bufferViewKey(bufferViewIdx)); data.data() != nullptr)
+			return data;
+
+		// The data is decoded without holding the lock, so that other threads can use the cache in the meantime.
+		StaticVector<std::byte> decoded(0);
+		if (const auto& compression = bufferView.meshoptCompression) {
+			if (!meshopt::isValidDecodedSize(*compression, bufferView.byteLength))
+				return {};
+
+			StaticVector<std::byte> compressedFileData(0);
+			auto compressed = getBufferRange(asset, compression->bufferIndex, compression->byteOffset, compression->byteLength,
+				&compressedFileData);
+			if (compressed.data() == nullptr)
+				return {};
+
+			decoded = StaticVector<std::byte>(compression->count * compression->byteStride);
+			if (!meshopt::decode(*compression, compressed, decoded.data()))
+				return {};
+		} else {
+			if (getBufferRange(asset, bufferView.bufferIndex, bufferView.byteOffset, bufferView.byteLength, &decoded).data() == nullptr)
+				return {};
+		}
+		return insert(bufferViewKey(bufferViewIdx), std::move(decoded));
+	}
+};
+
+fg::CachingBufferDataAdapter::CachingBufferDataAdapter(std::filesystem::path directory, std::size_t memoryBudget, std::filesystem::path glbPath)
+		: cache(std::make_shared<Cache>()) {
+	cache->directory = std::move(directory);
+	cache->glbPath = std::move(glbPath);
+	cache->memoryBudget = memoryBudget;
+}
+
+fg::CachingBufferDataAdapter::Bytes fg::CachingBufferDataAdapter::operator()(const Asset& asset, std::size_t bufferViewIdx) const {
+	auto data = cache->getBufferView(asset, bufferViewIdx);
+	assert(data.data() != nullptr && "Failed to load or decode the data of the buffer view.");
+	return data;
+}
+
+std::size_t fg::CachingBufferDataAdapter::memoryUsage() const {
+	std::lock_guard lock(cache->mutex);
+	return cache->memoryUsage;
+}
+
+void fg::CachingBufferDataAdapter::clear() {
+	std::lock_guard lock(cache->mutex);
+	cache->lookup.clear();
+	cache->entries.clear();
+	cache->memoryUsage = 0;
+}
+
+void fg::internal::fallback_compute_world_transforms(const Node* nodes, const std::size_t* order, const std::size_t* parents,
+		std::size_t count, const math::fmat4x4& initial, math::fmat4x4* worldMatrices) {
+	for (std::size_t i = 0; i < count; ++i) {
+		const auto& parent = parents[i] == SceneHierarchy::noParent ? initial : worldMatrices[parents[i]];
+		worldMatrices[order[i]] = visit_exhaustive(visitor {
+			[&](const math::fmat4x4& matrix) {
+				return parent * matrix;
+			},
+			[&](const TRS& trs) {
+				return parent * math::composeTransformMatrix(trs.translation, trs.rotation, trs.scale);
+			}
+		}, nodes[order[i]].transform);
+	}
+}
+
+void fg::internal::fallback_update_world_transforms(const math::fmat4x4* localMatrices, const std::size_t* order, const std::size_t* parents,
+		std::size_t count, const math::fmat4x4& initial, math::fmat4x4* worldMatrices) {
+	for (std::size_t i = 0; i < count; ++i) {
+		const auto& parent = parents[i] == SceneHierarchy::noParent ? initial : worldMatrices[parents[i]];
+		worldMatrices[order[i]] = parent * localMatrices[order[i]];
+	}
+}
+
+void fg::internal::fallback_compute_joint_matrices(const math::fmat4x4* worldMatrices, const std::size_t* joints,
+		const math::fmat4x4* inverseBindMatrices, std::size_t count, math::fmat4x4* jointMatrices) {
+	for (std::size_t i = 0; i < count; ++i) {
+		jointMatrices[i] = worldMatrices[joints[i]] * inverseBindMatrices[i];
+	}
+}
+
+#if defined(FASTGLTF_IS_X86)
+[[gnu::target("sse4.1")]] void fg::internal::sse4_compute_world_transforms(const Node* nodes, const std::size_t* order, const std::size_t* parents,
+		std::size_t count, const math::fmat4x4& initial, math::fmat4x4* worldMatrices) {
+	// The parent matrices and nodes are usually scattered in memory, so they are fetched ahead of time.
+	constexpr std::size_t prefetchDistance = 16;
+	for (std::size_t i = 0; i < count; ++i) {
+		if (i + prefetchDistance < count) {
+			const auto ahead = i + prefetchDistance;
+			if (parents[ahead] != SceneHierarchy::noParent)
+				_mm_prefetch(reinterpret_cast<const char*>(&worldMatrices[parents[ahead]]), _MM_HINT_T0);
+			_mm_prefetch(reinterpret_cast<const char*>(&nodes[order[ahead]].transform), _MM_HINT_T0);
+		}
+
+		const auto* parent = parents[i] == SceneHierarchy::noParent ? initial.data() : worldMatrices[parents[i]].data();
+		const auto p0 = _mm_loadu_ps(parent + 0);
+		const auto p1 = _mm_loadu_ps(parent + 4);
+		const auto p2 = _mm_loadu_ps(parent + 8);
+		const auto p3 = _mm_loadu_ps(parent + 12);
+
+		// Every column of the result is the parent matrix multiplied by the column of the local matrix.
+		auto* world = worldMatrices[order[i]].data();
+		auto multiplyColumn = [&](std::size_t column, float x, float y, float z, float w) {
+			auto result = _mm_mul_ps(p0, _mm_set1_ps(x));
+			result = _mm_add_ps(result, _mm_mul_ps(p1, _mm_set1_ps(y)));
+			result = _mm_add_ps(result, _mm_mul_ps(p2, _mm_set1_ps(z)));
+			result = _mm_add_ps(result, _mm_mul_ps(p3, _mm_set1_ps(w)));
+			_mm_storeu_ps(world + column * 4, result);
+		};
+
+		const auto& transform = nodes[order[i]].transform;
+		if (const auto* trs = std::get_if<TRS>(&transform)) {
+			// The local matrix is composed directly from the scaled rotation matrix and the translation.
+			const auto rotation = math::asMatrix(trs->rotation);
+			for (std::size_t c = 0; c < 3; ++c) {
+				multiplyColumn(c, rotation.col(c).x() * trs->scale[c], rotation.col(c).y() * trs->scale[c],
+					rotation.col(c).z() * trs->scale[c], 0.f);
+			}
+			multiplyColumn(3, trs->translation.x(), trs->translation.y(), trs->translation.z(), 1.f);
+		} else {
+			const auto* local = std::get<math::fmat4x4>(transform).data();
+			for (std::size_t c = 0; c < 4; ++c) {
+				multiplyColumn(c, local[c * 4 + 0], local[c * 4 + 1], local[c * 4 + 2], local[c * 4 + 3]);
+			}
+		}
+	}
+}
+[[gnu::target("sse4.1")]] void fg::internal::sse4_update_world_transforms(const math::fmat4x4* localMatrices, const std::size_t* order, const std::size_t* parents,
+		std::size_t count, const math::fmat4x4& initial, math::fmat4x4* worldMatrices) {
+	constexpr std::size_t prefetchDistance = 16;
+	for (std::size_t i = 0; i < count; ++i) {
+		if (i + prefetchDistance < count) {
+			const auto ahead = i + prefetchDistance;
+			if (parents[ahead] != SceneHierarchy::noParent)
+				_mm_prefetch(reinterpret_cast<const char*>(&worldMatrices[parents[ahead]]), _MM_HINT_T0);
+			_mm_prefetch(reinterpret_cast<const char*>(&localMatrices[order[ahead]]), _MM_HINT_T0);
+		}
+
+		const auto* parent = parents[i] == SceneHierarchy::noParent ? initial.data() : worldMatrices[parents[i]].data();
+		const auto p0 = _mm_loadu_ps(parent + 0);
+		const auto p1 = _mm_loadu_ps(parent + 4);
+		const auto p2 = _mm_loadu_ps(parent + 8);
+		const auto p3 = _mm_loadu_ps(parent + 12);
+
+		const auto* local = localMatrices[order[i]].data();
+		auto* world = worldMatrices[order[i]].data();
+		for (std::size_t c = 0; c < 4; ++c) {
+			auto result = _mm_mul_ps(p0, _mm_set1_ps(local[c * 4 + 0]));
+			result = _mm_add_ps(result, _mm_mul_ps(p1, _mm_set1_ps(local[c * 4 + 1])));
+			result = _mm_add_ps(result, _mm_mul_ps(p2, _mm_set1_ps(local[c * 4 + 2])));
+			result = _mm_add_ps(result, _mm_mul_ps(p3, _mm_set1_ps(local[c * 4 + 3])));
+			_mm_storeu_ps(world + c * 4, result);
+		}
+	}
+}
+
+[[gnu::target("sse4.1")]] void fg::internal::sse4_compute_joint_matrices(const math::fmat4x4* worldMatrices, const std::size_t* joints,
+		const math::fmat4x4* inverseBindMatrices, std::size_t count, math::fmat4x4* jointMatrices) {
+	// The inverse bind matrices and joint matrices are contiguous, but the world matrices of the joints are not.
+	constexpr std::size_t prefetchDistance = 8;
+	for (std::size_t i = 0; i < count; ++i) {
+		if (i + prefetchDistance < count)
+			_mm_prefetch(reinterpret_cast<const char*>(&worldMatrices[joints[i + prefetchDistance]]), _MM_HINT_T0);
+
+		const auto* world = worldMatrices[joints[i]].data();
+		const auto w0 = _mm_loadu_ps(world + 0);
+		const auto w1 = _mm_loadu_ps(world + 4);
+		const auto w2 = _mm_loadu_ps(world + 8);
+		const auto w3 = _mm_loadu_ps(world + 12);
+
+		const auto* inverseBind = inverseBindMatrices[i].data();
+		auto* joint = jointMatrices[i].data();
+		for (std::size_t c = 0; c < 4; ++c) {
+			auto result = _mm_mul_ps(w0, _mm_set1_ps(inverseBind[c * 4 + 0]));
+			result = _mm_add_ps(result, _mm_mul_ps(w1, _mm_set1_ps(inverseBind[c * 4 + 1])));
+			result = _mm_add_ps(result, _mm_mul_ps(w2, _mm_set1_ps(inverseBind[c * 4 + 2])));
+			result = _mm_add_ps(result, _mm_mul_ps(w3, _mm_set1_ps(inverseBind[c * 4 + 3])));
+			_mm_storeu_ps(joint + c * 4, result);
+		}
+	}
+}
+#elif defined(FASTGLTF_IS_A64)
+void fg::internal::neon_compute_world_transforms(const Node* nodes, const std::size_t* order, const std::size_t* parents,
+		std::size_t count, const math::fmat4x4& initial, math::fmat4x4* worldMatrices) {
+	for (std::size_t i = 0; i < count; ++i) {
+		const auto* parent = parents[i] == SceneHierarchy::noParent ? initial.data() : worldMatrices[parents[i]].data();
+		const auto p0 = vld1q_f32(parent + 0);
+		const auto p1 = vld1q_f32(parent + 4);
+		const auto p2 = vld1q_f32(parent + 8);
+		const auto p3 = vld1q_f32(parent + 12);
+
+		auto* world = worldMatrices[order[i]].data();
+		auto multiplyColumn = [&](std::size_t column, float x, float y, float z, float w) {
+			auto result = vmulq_n_f32(p0, x);
+			result = vaddq_f32(result, vmulq_n_f32(p1, y));
+			result = vaddq_f32(result, vmulq_n_f32(p2, z));
+			result = vaddq_f32(result, vmulq_n_f32(p3, w));
+			vst1q_f32(world + column * 4, result);
+		};
+
+		const auto& transform = nodes[order[i]].transform;
+		if (const auto* trs = std::get_if<TRS>(&transform)) {
+			const auto rotation = math::asMatrix(trs->rotation);
+			for (std::size_t c = 0; c < 3; ++c) {
+				multiplyColumn(c, rotation.col(c).x() * trs->scale[c], rotation.col(c).y() * trs->scale[c],
+					rotation.col(c).z() * trs->scale[c], 0.f);
+			}
+			multiplyColumn(3, trs->translation.x(), trs->translation.y(), trs->translation.z(), 1.f);
+		} else {
+			const auto* local = std::get<math::fmat4x4>(transform).data();
+			for (std::size_t c = 0; c < 4; ++c) {
+				multiplyColumn(c, local[c * 4 + 0], local[c * 4 + 1], local[c * 4 + 2], local[c * 4 + 3]);
+			}
+		}
+	}
+}
+
+void fg::internal::neon_update_world_transforms(const math::fmat4x4* localMatrices, const std::size_t* order, const std::size_t* parents,
+		std::size_t count, const math::fmat4x4& initial, math::fmat4x4* worldMatrices) {
+	for (std::size_t i = 0; i < count; ++i) {
+		const auto* parent = parents[i] == SceneHierarchy::noParent ? initial.data() : worldMatrices[parents[i]].data();
+		const auto p0 = vld1q_f32(parent + 0);
+		const auto p1 = vld1q_f32(parent + 4);
+		const auto p2 = vld1q_f32(parent + 8);
+		const auto p3 = vld1q_f32(parent + 12);
+
+		const auto* local = localMatrices[order[i]].data();
+		auto* world = worldMatrices[order[i]].data();
+		for (std::size_t c = 0; c < 4; ++c) {
+			auto result = vmulq_n_f32(p0, local[c * 4 + 0]);
+			result = vaddq_f32(result, vmulq_n_f32(p1, local[c * 4 + 1]));
+			result = vaddq_f32(result, vmulq_n_f32(p2, local[c * 4 + 2]));
+			result = vaddq_f32(result, vmulq_n_f32(p3, local[c * 4 + 3]));
+			vst1q_f32(world + c * 4, result);
+		}
+	}
+}
+
+void fg::internal::neon_compute_joint_matrices(const math::fmat4x4* worldMatrices, const std::size_t* joints,
+		const math::fmat4x4* inverseBindMatrices, std::size_t count, math::fmat4x4* jointMatrices) {
+	for (std::size_t i = 0; i < count; ++i) {
+		const auto* world = worldMatrices[joints[i]].data();
+		const auto w0 = vld1q_f32(world + 0);
+		const auto w1 = vld1q_f32(world + 4);
+		const auto w2 = vld1q_f32(world + 8);
+		const auto w3 = vld1q_f32(world + 12);
+
+		const auto* inverseBind = inverseBindMatrices[i].data();
+		auto* joint = jointMatrices[i].data();
+		for (std::size_t c = 0; c < 4; ++c) {
+			auto result = vmulq_n_f32(w0, inverseBind[c * 4 + 0]);
+			result = vaddq_f32(result, vmulq_n_f32(w1, inverseBind[c * 4 + 1]));
+			result = vaddq_f32(result, vmulq_n_f32(w2, inverseBind[c * 4 + 2]));
+			result = vaddq_f32(result, vmulq_n_f32(w3, inverseBind[c * 4 + 3]));
+			vst1q_f32(joint + c * 4, result);
+		}
+	}
+}
+#endif
+
+namespace fastgltf::internal {
+	using ComputeWorldTransformsFunction = void(*)(const Node*, const std::size_t*, const std::size_t*, std::size_t,
+		const math::fmat4x4&, math::fmat4x4*);
+	using UpdateWorldTransformsFunction = void(*)(const math::fmat4x4*, const std::size_t*, const std::size_t*, std::size_t,
+		const math::fmat4x4&, math::fmat4x4*);
+	using ComputeJointMatricesFunction = void(*)(const math::fmat4x4*, const std::size_t*, const math::fmat4x4*, std::size_t,
+		math::fmat4x4*);
+
+	struct TransformFunctionGetter {
+		ComputeWorldTransformsFunction computeWorldTransforms = fallback_compute_world_transforms;
+		UpdateWorldTransformsFunction updateWorldTransforms = fallback_update_world_transforms;
+		ComputeJointMatricesFunction computeJointMatrices = fallback_compute_joint_matrices;
+
+		explicit TransformFunctionGetter() {
+			const auto& impls = simdjson::get_available_implementations();
+#if defined(FASTGLTF_IS_X86)
+			if (const auto* sse4 = impls["westmere"]; sse4 != nullptr && sse4->supported_by_runtime_system()) {
+				computeWorldTransforms = sse4_compute_world_transforms;
+				updateWorldTransforms = sse4_update_world_transforms;
+				computeJointMatrices = sse4_compute_joint_matrices;
+			}
+#elif defined(FASTGLTF_IS_A64)
+			if (const auto* neon = impls["arm64"]; neon && neon->supported_by_runtime_system()) {
+				computeWorldTransforms = neon_compute_world_transforms;
+				updateWorldTransforms = neon_update_world_transforms;
+				computeJointMatrices = neon_compute_joint_matrices;
+			}
+#else
+			(void)impls;
+#endif
+		}
+
+		static TransformFunctionGetter* get() {
+			static TransformFunctionGetter getter;
+			return &getter;
+		}
+	};
+} // namespace fastgltf::internal
+
+fg::SceneHierarchy::SceneHierarchy(const Asset& asset, std::size_t sceneIndex) {
+	assert(sceneIndex < asset.scenes.size());
+	const auto& scene = asset.scenes[sceneIndex];
+
+	// Find the parent and depth of every node with an explicit stack.
+	constexpr auto unvisited = std::numeric_limits<std::size_t>::max();
+	std::vector<std::size_t> depths(asset.nodes.size(), unvisited);
+	std::vector<std::size_t> parents(asset.nodes.size(), noParent);
+	std::vector<std::size_t> stack;
+	std::vector<std::size_t> levelSizes;
+	for (auto root : scene.nodeIndices) {
+		assert(root < asset.nodes.size());
+		if (root >= asset.nodes.size() || depths[root] != unvisited)
+			continue;
+		depths[root] = 0;
+		stack.emplace_back(root);
+	}
+	while (!stack.empty()) {
+		const auto nodeIndex = stack.back();
+		stack.pop_back();
+		if (levelSizes.size() <= depths[nodeIndex])
+			levelSizes.resize(depths[nodeIndex] + 1, 0);
+		++levelSizes[depths[nodeIndex]];
+
+		for (auto child : asset.nodes[nodeIndex].children) {
+			assert(child < asset.nodes.size());
+			if (child >= asset.nodes.size() || depths[child] != unvisited)
+				continue;
+			depths[child] = depths[nodeIndex] + 1;
+			parents[child] = nodeIndex;
+			stack.emplace_back(child);
+		}
+	}
+
+	// Sort the nodes by their depth, and by their index within each level. Any order with parents
+	// before their children works, but this one accesses the nodes and matrices mostly sequentially.
+	std::vector<std::size_t> levelOffsets(levelSizes.size(), 0);
+	std::size_t nodeCount = 0;
+	for (std::size_t level = 0; level < levelSizes.size(); ++level) {
+		levelOffsets[level] = nodeCount;
+		nodeCount += levelSizes[level];
+	}
+
+	nodeIndices.resize(nodeCount);
+	parentIndices.resize(nodeCount);
+	for (std::size_t i = 0; i < asset.nodes.size(); ++i) {
+		if (depths[i] == unvisited)
+			continue;
+		const auto position = levelOffsets[depths[i]]++;
+		nodeIndices[position] = i;
+		parentIndices[position] = parents[i];
+	}
+}
+
+void fg::computeWorldTransforms(const Asset& asset, const SceneHierarchy& hierarchy, span<math::fmat4x4> worldMatrices,
+		const math::fmat4x4& initial) {
+	assert(worldMatrices.size() >= asset.nodes.size());
+	internal::TransformFunctionGetter::get()->computeWorldTransforms(asset.nodes.data(), hierarchy.nodes().data(),
+		hierarchy.parents().data(), hierarchy.size(), initial, worldMatrices.data());
+}
+
+fg::TransformCache::TransformCache(const Asset& asset, std::size_t sceneIndex, const math::fmat4x4& initial) : initial(initial) {
+	assert(sceneIndex < asset.scenes.size());
+	const auto& scene = asset.scenes[sceneIndex];
+	const auto nodeCount = asset.nodes.size();
+
+	// Traverse the scene depth-first with an explicit stack, so that every subtree is a contiguous range.
+	positions.assign(nodeCount, notInScene);
+	std::vector<std::pair<std::size_t, std::size_t>> stack;
+	for (auto it = scene.nodeIndices.rbegin(); it != scene.nodeIndices.rend(); ++it) {
+		stack.emplace_back(*it, SceneHierarchy::noParent);
+	}
+	while (!stack.empty()) {
+		const auto [nodeIndex, parentIndex] = stack.back();
+		stack.pop_back();
+		assert(nodeIndex < nodeCount);
+		if (nodeIndex >= nodeCount || positions[nodeIndex] != notInScene)
+			continue;
+
+		positions[nodeIndex] = order.size();
+		order.emplace_back(nodeIndex);
+		parents.emplace_back(parentIndex);
+
+		const auto& children = asset.nodes[nodeIndex].children;
+		for (auto it = children.rbegin(); it != children.rend(); ++it) {
+			stack.emplace_back(*it, nodeIndex);
+		}
+	}
+
+	// Each subtree ends where the last subtree of its children ends.
+	subtreeEnds.resize(order.size());
+	for (std::size_t i = order.size(); i-- > 0;) {
+		subtreeEnds[i] = max(subtreeEnds[i], i + 1);
+		if (parents[i] != SceneHierarchy::noParent) {
+			auto& parentEnd = subtreeEnds[positions[parents[i]]];
+			parentEnd = max(parentEnd, subtreeEnds[i]);
+		}
+	}
+
+	nodeTranslations.resize(nodeCount);
+	nodeRotations.resize(nodeCount);
+	nodeScales.resize(nodeCount);
+	matrixNodes.resize(nodeCount);
+	localMatrices.resize(nodeCount);
+	for (std::size_t i = 0; i < nodeCount; ++i) {
+		visit_exhaustive(visitor {
+			[&](const math::fmat4x4& matrix) {
+				matrixNodes[i] = true;
+				localMatrices[i] = matrix;
+				math::decomposeTransformMatrix(matrix, nodeScales[i], nodeRotations[i], nodeTranslations[i]);
+			},
+			[&](const TRS& trs) {
+				matrixNodes[i] = false;
+				nodeTranslations[i] = trs.translation;
+				nodeRotations[i] = trs.rotation;
+				nodeScales[i] = trs.scale;
+				localMatrices[i] = math::composeTransformMatrix(trs.translation, trs.rotation, trs.scale);
+			}
+		}, asset.nodes[i].transform);
+	}
+
+	worldMatrices.resize(nodeCount);
+	dirtyBits.resize((nodeCount + 63) / 64);
+	internal::TransformFunctionGetter::get()->updateWorldTransforms(localMatrices.data(), order.data(), parents.data(),
+		order.size(), initial, worldMatrices.data());
+}
+
+void fg::TransformCache::markDirty(std::size_t nodeIndex) noexcept {
+	auto& bits = dirtyBits[nodeIndex / 64];
+	const auto mask = std::uint64_t(1) << (nodeIndex % 64);
+	if ((bits & mask) == 0) {
+		bits |= mask;
+		dirtyNodes.emplace_back(nodeIndex);
+	}
+}
+
+void fg::TransformCache::setTranslation(std::size_t nodeIndex, const math::fvec3& translation) {
+	assert(nodeIndex < nodeTranslations.size());
+	matrixNodes[nodeIndex] = false;
+	nodeTranslations[nodeIndex] = translation;
+	markDirty(nodeIndex);
+}
+
+void fg::TransformCache::setRotation(std::size_t nodeIndex, const math::fquat& rotation) {
+	assert(nodeIndex < nodeRotations.size());
+	matrixNodes[nodeIndex] = false;
+	nodeRotations[nodeIndex] = rotation;
+	markDirty(nodeIndex);
+}
+
+void fg::TransformCache::setScale(std::size_t nodeIndex, const math::fvec3& scale) {
+	assert(nodeIndex < nodeScales.size());
+	matrixNodes[nodeIndex] = false;
+	nodeScales[nodeIndex] = scale;
+	markDirty(nodeIndex);
+}
+
+void fg::TransformCache::setTRS(std::size_t nodeIndex, const TRS& trs) {
+	assert(nodeIndex < nodeTranslations.size());
+	matrixNodes[nodeIndex] = false;
+	nodeTranslations[nodeIndex] = trs.translation;
+	nodeRotations[nodeIndex] = trs.rotation;
+	nodeScales[nodeIndex] = trs.scale;
+	markDirty(nodeIndex);
+}
+
+void fg::TransformCache::setMatrix(std::size_t nodeIndex, const math::fmat4x4& matrix) {
+	assert(nodeIndex < localMatrices.size());
+	matrixNodes[nodeIndex] = true;
+	localMatrices[nodeIndex] = matrix;
+	math::decomposeTransformMatrix(matrix, nodeScales[nodeIndex], nodeRotations[nodeIndex], nodeTranslations[nodeIndex]);
+	markDirty(nodeIndex);
+}
+
+void fg::TransformCache::setTranslations(span<const std::size_t> nodeIndices, span<const math::fvec3> translations) {
+	assert(nodeIndices.size() == translations.size());
+	for (std::size_t i = 0; i < nodeIndices.size(); ++i) {
+		setTranslation(nodeIndices[i], translations[i]);
+	}
+}
+
+void fg::TransformCache::setRotations(span<const std::size_t> nodeIndices, span<const math::fquat> rotations) {
+	assert(nodeIndices.size() == rotations.size());
+	for (std::size_t i = 0; i < nodeIndices.size(); ++i) {
+		setRotation(nodeIndices[i], rotations[i]);
+	}
+}
+
+void fg::TransformCache::setScales(span<const std::size_t> nodeIndices, span<const math::fvec3> scales) {
+	assert(nodeIndices.size() == scales.size());
+	for (std::size_t i = 0; i < nodeIndices.size(); ++i) {
+		setScale(nodeIndices[i], scales[i]);
+	}
+}
+
+std::size_t fg::TransformCache::update() {
+	// Recompose the local matrices of all dirty nodes, and replace each node with its position in
+	// the hierarchy. Nodes which are not part of the scene have no world matrix to update.
+	std::size_t dirtyCount = 0;
+	for (const auto nodeIndex : dirtyNodes) {
+		dirtyBits[nodeIndex / 64] &= ~(std::uint64_t(1) << (nodeIndex % 64));
+		if (!matrixNodes[nodeIndex]) {
+			localMatrices[nodeIndex] = math::composeTransformMatrix(nodeTranslations[nodeIndex], nodeRotations[nodeIndex], nodeScales[nodeIndex]);
+		}
+		if (positions[nodeIndex] != notInScene) {
+			dirtyNodes[dirtyCount++] = positions[nodeIndex];
+		}
+	}
+	dirtyNodes.resize(dirtyCount);
+	std::sort(dirtyNodes.begin(), dirtyNodes.end());
+
+	// Recompute the subtree of each dirty node, skipping dirty nodes within an already updated subtree.
+	const auto updateWorldTransforms = internal::TransformFunctionGetter::get()->updateWorldTransforms;
+	std::size_t updatedCount = 0;
+	std::size_t updatedEnd = 0;
+	for (const auto position : dirtyNodes) {
+		if (position < updatedEnd)
+			continue;
+		updatedEnd = subtreeEnds[position];
+		updateWorldTransforms(localMatrices.data(), order.data() + position, parents.data() + position,
+			updatedEnd - position, initial, worldMatrices.data());
+		updatedCount += updatedEnd - position;
+	}
+	dirtyNodes.clear();
+	return updatedCount;
+}
+
+void fg::SkinningCache::computeJointMatrices(std::size_t skinIndex, span<const math::fmat4x4> worldMatrices,
+		span<math::fmat4x4> jointMatrices) const {
+	assert(skinIndex < skinCount());
+	const auto offset = offsets[skinIndex];
+	const auto count = offsets[skinIndex + 1] - offset;
+	assert(jointMatrices.size() >= count);
+	assert(std::all_of(jointIndices.data() + offset, jointIndices.data() + offset + count,
+		[&](std::size_t joint) { return joint < worldMatrices.size(); }));
+	internal::TransformFunctionGetter::get()->computeJointMatrices(worldMatrices.data(), jointIndices.data() + offset,
+		inverseBindMatrices.data() + offset, count, jointMatrices.data());
+}
+
+void fg::SkinningCache::computeAllJointMatrices(span<const math::fmat4x4> worldMatrices, span<math::fmat4x4> jointMatrices) const {
+	assert(jointMatrices.size() >= jointIndices.size());
+	assert(std::all_of(jointIndices.begin(), jointIndices.end(), [&](std::size_t joint) { return joint < worldMatrices.size(); }));
+	internal::TransformFunctionGetter::get()->computeJointMatrices(worldMatrices.data(), jointIndices.data(),
+		inverseBindMatrices.data(), jointIndices.size(), jointMatrices.data());
+}
+
+namespace fastgltf::internal {
+	/**
+	 * Finds the keyframe k for which keyTimes[k] <= time < keyTimes[k + 1], starting at the keyframe found
+	 * previously. The time has to be within the first and last keyframe.
+	 */
+	std::size_t findKeyframe(const float* keyTimes, std::size_t keyCount, float time, std::size_t cursor) {
+		// During playback, the time usually only moves on by one or two keyframes between calls.
+		if (cursor < keyCount && keyTimes[cursor] <= time) {
+			for (const auto end = std::min(cursor + 4, keyCount - 1); cursor < end; ++cursor) {
+				if (time < keyTimes[cursor + 1])
+					return cursor;
+			}
+		}
+		auto* upper = std::upper_bound(keyTimes, keyTimes + keyCount, time);
+		return static_cast<std::size_t>(upper - keyTimes) - 1;
+	}
+
+	void normalizeQuaternion(float* q) {
+		const auto length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+		if (length > 0.f) {
+			for (std::size_t i = 0; i < 4; ++i)
+				q[i] /= length;
+		}
+	}
+
+	void slerpQuaternion(const float* a, const float* b, float t, float* result) {
+		auto d = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+
+		// Interpolate along the shorter arc.
+		float sign = 1.f;
+		if (d < 0.f) {
+			d = -d;
+			sign = -1.f;
+		}
+
+		float weightA = 1.f - t;
+		float weightB = t;
+		if (d < 0.9995f) {
+			const auto theta = std::acos(d);
+			const auto sinTheta = std::sin(theta);
+			weightA = std::sin((1.f - t) * theta) / sinTheta;
+			weightB = std::sin(t * theta) / sinTheta;
+		}
+		weightB *= sign;
+
+		for (std::size_t i = 0; i < 4; ++i)
+			result[i] = weightA * a[i] + weightB * b[i];
+		normalizeQuaternion(result);
+	}
+} // namespace fastgltf::internal
+
+void fg::AnimationEvaluator::addChannels(const Asset& asset, const Animation& animation) {
+	bool hasKeyframes = false;
+	channels.reserve(animation.channels.size());
+	for (const auto& channel : animation.channels) {
+		if (!channel.nodeIndex.has_value() || *channel.nodeIndex >= asset.nodes.size())
+			continue;
+		if (channel.samplerIndex >= samplers.size())
+			continue;
+
+		const auto& sampler = samplers[channel.samplerIndex];
+		if (sampler.keyCount == 0)
+			continue;
+
+		// Cubic spline samplers store an in-tangent, the value, and an out-tangent for each keyframe.
+		const std::size_t elementsPerKey = sampler.interpolation == AnimationInterpolation::CubicSpline ? 3 : 1;
+		const auto elementCount = sampler.valueCount / sampler.componentCount;
+		std::size_t width = 0;
+		switch (channel.path) {
+			case AnimationPath::Translation:
+			case AnimationPath::Scale:
+				width = sampler.componentCount == 3 ? 3 : 0;
+				break;
+			case AnimationPath::Rotation:
+				width = sampler.componentCount == 4 ? 4 : 0;
+				break;
+			case AnimationPath::Weights:
+				width = sampler.componentCount == 1 ? elementCount / (sampler.keyCount * elementsPerKey) : 0;
+				break;
+		}
+		if (width == 0 || sampler.valueCount < sampler.keyCount * elementsPerKey * width)
+			continue;
+
+		channels.push_back(Channel {
+			channel.samplerIndex, *channel.nodeIndex, channel.path, width, results.size(), 0,
+		});
+		results.resize(results.size() + width);
+
+		const auto* keyTimes = &times[sampler.timeOffset];
+		startTime = hasKeyframes ? std::min(startTime, keyTimes[0]) : keyTimes[0];
+		endTime = hasKeyframes ? std::max(endTime, keyTimes[sampler.keyCount - 1]) : keyTimes[sampler.keyCount - 1];
+		hasKeyframes = true;
+	}
+
+	evaluate(startTime);
+}
+
+void fg::AnimationEvaluator::evaluate(float time) {
+	for (auto& channel : channels) {
+		const auto& sampler = samplers[channel.samplerIndex];
+		const auto width = channel.width;
+		const auto* keyTimes = &times[sampler.timeOffset];
+		auto* result = &results[channel.resultOffset];
+
+		// Point at the value of the first keyframe, skipping the in-tangent of cubic splines.
+		const bool cubic = sampler.interpolation == AnimationInterpolation::CubicSpline;
+		const auto keyStride = cubic ? 3 * width : width;
+		const auto* keyValues = &values[sampler.valueOffset + (cubic ? width : 0)];
+
+		const auto lastKey = sampler.keyCount - 1;
+		if (time <= keyTimes[0] || time >= keyTimes[lastKey]) {
+			const auto key = time <= keyTimes[0] ? 0 : lastKey;
+			std::memcpy(result, keyValues + key * keyStride, width * sizeof(float));
+			channel.cursor = key;
+			continue;
+		}
+
+		const auto key = internal::findKeyframe(keyTimes, sampler.keyCount, time, channel.cursor);
+		channel.cursor = key;
+
+		const auto* v0 = keyValues + key * keyStride;
+		const auto* v1 = v0 + keyStride;
+		const auto delta = keyTimes[key + 1] - keyTimes[key];
+		const auto t = delta > 0.f ? (time - keyTimes[key]) / delta : 0.f;
+
+		switch (sampler.interpolation) {
+			case AnimationInterpolation::Step: {
+				std::memcpy(result, v0, width * sizeof(float));
+				break;
+			}
+			case AnimationInterpolation::Linear: {
+				if (channel.path == AnimationPath::Rotation) {
+					internal::slerpQuaternion(v0, v1, t, result);
+				} else {
+					for (std::size_t i = 0; i < width; ++i)
+						result[i] = v0[i] + (v1[i] - v0[i]) * t;
+				}
+				break;
+			}
+			case AnimationInterpolation::CubicSpline: {
+				// Cubic Hermite spline, using the out-tangent of this keyframe and the in-tangent of the next.
+				const auto* outTangent = v0 + width;
+				const auto* inTangent = v1 - width;
+				const auto t2 = t * t;
+				const auto t3 = t2 * t;
+				const auto h00 = 2.f * t3 - 3.f * t2 + 1.f;
+				const auto h10 = (t3 - 2.f * t2 + t) * delta;
+				const auto h01 = -2.f * t3 + 3.f * t2;
+				const auto h11 = (t3 - t2) * delta;
+				for (std::size_t i = 0; i < width; ++i)
+					result[i] = h00 * v0[i] + h10 * outTangent[i] + h01 * v1[i] + h11 * inTangent[i];
+				if (channel.path == AnimationPath::Rotation)
+					internal::normalizeQuaternion(result);
+				break;
+			}
+		}
+	}
+}
+
+void fg::AnimationEvaluator::apply(Asset& asset) const {
+	for (const auto& channel : channels) {
+		auto& node = asset.nodes[channel.nodeIndex];
+		const auto* result = &results[channel.resultOffset];
+		if (channel.path == AnimationPath::Weights) {
+			node.weights.resize(channel.width);
+			for (std::size_t i = 0; i < channel.width; ++i)
+				node.weights[i] = static_cast<num>(result[i]);
+			continue;
+		}
+
+		if (const auto* matrix = std::get_if<math::fmat4x4>(&node.transform)) {
+			TRS trs;
+			math::decomposeTransformMatrix(*matrix, trs.scale, trs.rotation, trs.translation);
+			node.transform = trs;
+		}
+		auto& trs = std::get<TRS>(node.transform);
+		switch (channel.path) {
+			case AnimationPath::Translation:
+				trs.translation = math::fvec3(result[0], result[1], result[2]);
+				break;
+			case AnimationPath::Rotation:
+				trs.rotation = math::fquat(result[0], result[1], result[2], result[3]);
+				break;
+			case AnimationPath::Scale:
+				trs.scale = math::fvec3(result[0], result[1], result[2]);
+				break;
+			case AnimationPath::Weights:
+				break;
+		}
+	}
+}
+
+void fg::AnimationEvaluator::apply(TransformCache& cache) const {
+	for (const auto& channel : channels) {
+		const auto* result = &results[channel.resultOffset];
+		switch (channel.path) {
+			case AnimationPath::Translation:
+				cache.setTranslation(channel.nodeIndex, math::fvec3(result[0], result[1], result[2]));
+				break;
+			case AnimationPath::Rotation:
+				cache.setRotation(channel.nodeIndex, math::fquat(result[0], result[1], result[2], result[3]));
+				break;
+			case AnimationPath::Scale:
+				cache.setScale(channel.nodeIndex, math::fvec3(result[0], result[1], result[2]));
+				break;
+			case AnimationPath::Weights:
+				break;
+		}
+	}
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
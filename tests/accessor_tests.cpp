@@ -1,3 +1,8 @@
+#include <atomic>
+#include <fstream>
+#include <random>
+#include <thread>
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -328,3 +333,616 @@ TEST_CASE("Test sparse accessor", "[gltf-tools]") {
 		REQUIRE(std::memcmp(dstCopy.get(), checkValues.get(), secondAccessor.count * sizeof(fastgltf::math::fvec3)) == 0);
 	}
 }
+
+TEST_CASE("Test batch conversion kernels", "[gltf-tools]") {
+	// Every 16-bit pattern, which also covers every 8-bit value multiple times.
+	std::vector<std::uint16_t> input(std::numeric_limits<std::uint16_t>::max() + 1);
+	for (std::size_t i = 0; i < input.size(); ++i) {
+		input[i] = static_cast<std::uint16_t>(i);
+	}
+	const auto* bytes = reinterpret_cast<const std::byte*>(input.data());
+
+	for (auto componentType : { fastgltf::ComponentType::Byte, fastgltf::ComponentType::UnsignedByte,
+								fastgltf::ComponentType::Short, fastgltf::ComponentType::UnsignedShort }) {
+		// Use a count which is not a multiple of any vector width to also test the remainders.
+		const auto count = input.size() * sizeof(std::uint16_t) / fastgltf::getComponentByteSize(componentType) - 3;
+		for (bool normalized : { false, true }) {
+			std::vector<float> expected(count);
+			for (std::size_t i = 0; i < count; ++i) {
+				expected[i] = fastgltf::internal::getAccessorComponentAt<float>(componentType, fastgltf::AccessorType::Scalar, bytes, i, normalized);
+			}
+
+			std::vector<float> converted(count);
+			fastgltf::internal::fallback_convert_to_float(bytes, converted.data(), count, componentType, normalized);
+			REQUIRE(std::memcmp(converted.data(), expected.data(), count * sizeof(float)) == 0);
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_IX86)
+			fastgltf::internal::sse4_convert_to_float(bytes, converted.data(), count, componentType, normalized);
+			REQUIRE(std::memcmp(converted.data(), expected.data(), count * sizeof(float)) == 0);
+			fastgltf::internal::avx2_convert_to_float(bytes, converted.data(), count, componentType, normalized);
+			REQUIRE(std::memcmp(converted.data(), expected.data(), count * sizeof(float)) == 0);
+#endif
+#if defined(__aarch64__)
+			fastgltf::internal::neon_convert_to_float(bytes, converted.data(), count, componentType, normalized);
+			REQUIRE(std::memcmp(converted.data(), expected.data(), count * sizeof(float)) == 0);
+#endif
+		}
+
+		if (componentType == fastgltf::ComponentType::UnsignedByte || componentType == fastgltf::ComponentType::UnsignedShort) {
+			std::vector<std::uint32_t> expected(count);
+			for (std::size_t i = 0; i < count; ++i) {
+				expected[i] = fastgltf::internal::getAccessorComponentAt<std::uint32_t>(componentType, fastgltf::AccessorType::Scalar, bytes, i);
+			}
+
+			std::vector<std::uint32_t> widened(count);
+			fastgltf::internal::fallback_widen_indices(bytes, widened.data(), count, componentType);
+			REQUIRE(widened == expected);
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_IX86)
+			fastgltf::internal::sse4_widen_indices(bytes, widened.data(), count, componentType);
+			REQUIRE(widened == expected);
+			fastgltf::internal::avx2_widen_indices(bytes, widened.data(), count, componentType);
+			REQUIRE(widened == expected);
+#endif
+#if defined(__aarch64__)
+			fastgltf::internal::neon_widen_indices(bytes, widened.data(), count, componentType);
+			REQUIRE(widened == expected);
+#endif
+		}
+	}
+}
+
+TEST_CASE("Test float to half conversion", "[gltf-tools]") {
+	std::vector<float> floats = {
+		0.0f, -0.0f, 1.0f, -2.0f, 0.5f, 65504.0f, 65519.0f, 65520.0f, 1e-8f, 5.96046448e-8f, 6.1035156e-5f,
+		1.0f + 1.0f / 2048.0f, 1.0f + 3.0f / 2048.0f, std::numeric_limits<float>::infinity(),
+		-std::numeric_limits<float>::infinity(),
+	};
+	const std::vector<std::uint16_t> expected = {
+		0x0000, 0x8000, 0x3C00, 0xC000, 0x3800, 0x7BFF, 0x7BFF, 0x7C00, 0x0000, 0x0001, 0x0400,
+		0x3C00, 0x3C02, 0x7C00, 0xFC00,
+	};
+
+	std::vector<std::uint16_t> halves(floats.size());
+	fastgltf::convertToHalf(floats.data(), halves.data(), floats.size());
+	REQUIRE(halves == expected);
+
+	// Compare the SIMD kernels against the scalar implementation using lots of different bit patterns.
+	std::vector<float> patterns;
+	for (std::uint32_t bits = 0; bits < 0xFFFF0000U; bits += 0x10001U) {
+		patterns.push_back(fastgltf::bit_cast<float>(bits));
+	}
+	std::vector<std::uint16_t> fallback(patterns.size());
+	fastgltf::internal::fallback_convert_to_half(patterns.data(), fallback.data(), patterns.size());
+
+	halves.resize(patterns.size());
+	fastgltf::convertToHalf(patterns.data(), halves.data(), patterns.size());
+	REQUIRE(halves == fallback);
+}
+
+TEST_CASE("Test batch converting accessors", "[gltf-tools]") {
+	// Interleaved normalized u8vec4 colors and u16vec3 positions, each padded to 4-byte alignment.
+	constexpr std::size_t vertexCount = 1000;
+	constexpr std::size_t stride = 12;
+	std::vector<std::byte> data(vertexCount * stride + vertexCount * sizeof(std::uint16_t));
+	for (std::size_t i = 0; i < data.size(); ++i) {
+		data[i] = static_cast<std::byte>(i * 7 + (i >> 8));
+	}
+
+	fastgltf::Asset asset;
+	asset.buffers.emplace_back();
+	asset.buffers.back().byteLength = data.size();
+	asset.buffers.back().data = fastgltf::sources::ByteView { fastgltf::span<const std::byte>(data.data(), data.size()) };
+
+	asset.bufferViews.emplace_back();
+	asset.bufferViews.back().bufferIndex = 0;
+	asset.bufferViews.back().byteLength = vertexCount * stride;
+	asset.bufferViews.back().byteStride = stride;
+	asset.bufferViews.emplace_back();
+	asset.bufferViews.back().bufferIndex = 0;
+	asset.bufferViews.back().byteOffset = vertexCount * stride;
+	asset.bufferViews.back().byteLength = vertexCount * sizeof(std::uint16_t);
+
+	asset.accessors.reserve(3);
+	auto addAccessor = [&](std::size_t view, std::size_t offset, fastgltf::AccessorType type, fastgltf::ComponentType componentType, bool normalized) -> auto& {
+		auto& accessor = asset.accessors.emplace_back();
+		accessor.bufferViewIndex = view;
+		accessor.byteOffset = offset;
+		accessor.count = vertexCount;
+		accessor.type = type;
+		accessor.componentType = componentType;
+		accessor.normalized = normalized;
+		return accessor;
+	};
+	auto& colors = addAccessor(0, 0, fastgltf::AccessorType::Vec4, fastgltf::ComponentType::UnsignedByte, true);
+	auto& positions = addAccessor(0, 4, fastgltf::AccessorType::Vec3, fastgltf::ComponentType::Short, false);
+	auto& indices = addAccessor(1, 0, fastgltf::AccessorType::Scalar, fastgltf::ComponentType::UnsignedShort, false);
+
+	SECTION("copyFromAccessor") {
+		std::vector<fastgltf::math::fvec4> copiedColors(vertexCount);
+		fastgltf::copyFromAccessor<fastgltf::math::fvec4>(asset, colors, copiedColors.data());
+		fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec4>(asset, colors, [&](fastgltf::math::fvec4 color, std::size_t i) {
+			REQUIRE(copiedColors[i] == color);
+		});
+
+		std::vector<fastgltf::math::fvec3> copiedPositions(vertexCount);
+		fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset, positions, copiedPositions.data());
+		fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec3>(asset, positions, [&](fastgltf::math::fvec3 position, std::size_t i) {
+			REQUIRE(copiedPositions[i] == position);
+		});
+
+		std::vector<std::uint32_t> copiedIndices(vertexCount);
+		fastgltf::copyFromAccessor<std::uint32_t>(asset, indices, copiedIndices.data());
+		fastgltf::iterateAccessorWithIndex<std::uint32_t>(asset, indices, [&](std::uint32_t index, std::size_t i) {
+			REQUIRE(copiedIndices[i] == index);
+		});
+	}
+
+	SECTION("copyFromAccessor with target stride") {
+		// Write into a strided vertex struct, leaving the padding untouched.
+		constexpr std::size_t targetStride = 20;
+		std::vector<std::byte> vertices(vertexCount * targetStride, std::byte(0xAB));
+		fastgltf::copyFromAccessor<fastgltf::math::fvec4, targetStride>(asset, colors, vertices.data());
+		fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec4>(asset, colors, [&](fastgltf::math::fvec4 color, std::size_t i) {
+			fastgltf::math::fvec4 copied;
+			std::memcpy(&copied, &vertices[i * targetStride], sizeof copied);
+			REQUIRE(copied == color);
+			REQUIRE(vertices[i * targetStride + sizeof copied] == std::byte(0xAB));
+		});
+	}
+
+	SECTION("copyComponentsFromAccessor") {
+		std::vector<float> components(vertexCount * 3);
+		fastgltf::copyComponentsFromAccessor<float>(asset, positions, components.data());
+		fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec3>(asset, positions, [&](fastgltf::math::fvec3 position, std::size_t i) {
+			REQUIRE(position == fastgltf::math::fvec3(components[i * 3 + 0], components[i * 3 + 1], components[i * 3 + 2]));
+		});
+	}
+}
+
+TEST_CASE("Test parallel accessor functions", "[gltf-tools]") {
+	// Normalized u16vec3 positions padded to 8 bytes, with every 1000th element being replaced by a sparse value.
+	constexpr std::size_t vertexCount = fastgltf::parallelAccessorChunkSize * 5 + 123;
+	constexpr std::size_t stride = 8;
+	constexpr std::size_t sparseCount = vertexCount / 1000;
+	std::vector<std::byte> data(vertexCount * stride + sparseCount * (sizeof(std::uint32_t) + 3 * sizeof(std::uint16_t)));
+	for (std::size_t i = 0; i < data.size(); ++i) {
+		data[i] = static_cast<std::byte>(i * 7 + (i >> 8));
+	}
+	auto* sparseIndices = reinterpret_cast<std::uint32_t*>(data.data() + vertexCount * stride);
+	for (std::size_t i = 0; i < sparseCount; ++i) {
+		sparseIndices[i] = static_cast<std::uint32_t>(i * 1000 + 17);
+	}
+
+	fastgltf::Asset asset;
+	asset.buffers.emplace_back();
+	asset.buffers.back().byteLength = data.size();
+	asset.buffers.back().data = fastgltf::sources::ByteView { fastgltf::span<const std::byte>(data.data(), data.size()) };
+
+	asset.bufferViews.emplace_back();
+	asset.bufferViews.back().bufferIndex = 0;
+	asset.bufferViews.back().byteLength = vertexCount * stride;
+	asset.bufferViews.back().byteStride = stride;
+	asset.bufferViews.emplace_back();
+	asset.bufferViews.back().bufferIndex = 0;
+	asset.bufferViews.back().byteOffset = vertexCount * stride;
+	asset.bufferViews.back().byteLength = sparseCount * sizeof(std::uint32_t);
+	asset.bufferViews.emplace_back();
+	asset.bufferViews.back().bufferIndex = 0;
+	asset.bufferViews.back().byteOffset = vertexCount * stride + sparseCount * sizeof(std::uint32_t);
+	asset.bufferViews.back().byteLength = sparseCount * 3 * sizeof(std::uint16_t);
+
+	auto& accessor = asset.accessors.emplace_back();
+	accessor.bufferViewIndex = 0;
+	accessor.count = vertexCount;
+	accessor.type = fastgltf::AccessorType::Vec3;
+	accessor.componentType = fastgltf::ComponentType::UnsignedShort;
+	accessor.normalized = true;
+
+	std::size_t taskCount = 0;
+	auto parallelCallback = [](std::size_t taskCount, void (*task)(std::size_t, void*), void* taskData, void* userPointer) {
+		*static_cast<std::size_t*>(userPointer) += taskCount;
+		std::vector<std::thread> threads;
+		for (std::size_t i = 0; i < taskCount; ++i)
+			threads.emplace_back(task, i, taskData);
+		for (auto& thread : threads)
+			thread.join();
+	};
+
+	auto checkAccessor = [&]() {
+		std::vector<fastgltf::math::fvec3> expected(vertexCount);
+		fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset, accessor, expected.data());
+
+		taskCount = 0;
+		std::vector<fastgltf::math::fvec3> copied(vertexCount);
+		fastgltf::parallelCopyFromAccessor<fastgltf::math::fvec3>(asset, accessor, copied.data(), parallelCallback, &taskCount);
+		REQUIRE(taskCount == 6);
+		REQUIRE(std::memcmp(copied.data(), expected.data(), vertexCount * sizeof(fastgltf::math::fvec3)) == 0);
+
+		taskCount = 0;
+		std::vector<fastgltf::math::fvec3> iterated(vertexCount);
+		std::vector<std::uint8_t> visited(vertexCount, 0);
+		fastgltf::parallelIterateAccessorWithIndex<fastgltf::math::fvec3>(asset, accessor, [&](fastgltf::math::fvec3 position, std::size_t i) {
+			iterated[i] = position;
+			++visited[i];
+		}, parallelCallback, &taskCount);
+		REQUIRE(taskCount == 6);
+		REQUIRE(std::all_of(visited.begin(), visited.end(), [](std::uint8_t count) { return count == 1; }));
+		REQUIRE(std::memcmp(iterated.data(), expected.data(), vertexCount * sizeof(fastgltf::math::fvec3)) == 0);
+	};
+
+	SECTION("Dense accessor") {
+		checkAccessor();
+	}
+
+	SECTION("Sparse accessor") {
+		fastgltf::SparseAccessor sparse {};
+		sparse.count = sparseCount;
+		sparse.indicesBufferView = 1;
+		sparse.indexComponentType = fastgltf::ComponentType::UnsignedInt;
+		sparse.valuesBufferView = 2;
+		accessor.sparse = sparse;
+		checkAccessor();
+	}
+
+	SECTION("Sparse accessor with duplicate indices") {
+		// Invalid, as the indices have to be strictly increasing, but the last value should still win.
+		for (std::size_t i = 0; i < sparseCount; ++i) {
+			sparseIndices[i] = static_cast<std::uint32_t>((i / 2) * 2000 + 17);
+		}
+		fastgltf::SparseAccessor sparse {};
+		sparse.count = sparseCount;
+		sparse.indicesBufferView = 1;
+		sparse.indexComponentType = fastgltf::ComponentType::UnsignedInt;
+		sparse.valuesBufferView = 2;
+		accessor.sparse = sparse;
+
+		// Only the copy is compared, as the sparse lookup used by the iteration assumes sorted indices.
+		std::vector<fastgltf::math::fvec3> expected(vertexCount);
+		fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset, accessor, expected.data());
+		std::vector<fastgltf::math::fvec3> copied(vertexCount);
+		fastgltf::parallelCopyFromAccessor<fastgltf::math::fvec3>(asset, accessor, copied.data(), parallelCallback, &taskCount);
+		REQUIRE(std::memcmp(copied.data(), expected.data(), vertexCount * sizeof(fastgltf::math::fvec3)) == 0);
+	}
+}
+
+TEST_CASE("Test sparse accessor lookup", "[gltf-tools]") {
+	// A float accessor where every element holds its own index, and every seventh element is replaced by its negation.
+	constexpr std::size_t count = 10000;
+	constexpr std::size_t sparseCount = count / 7;
+	std::vector<float> dense(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		dense[i] = static_cast<float>(i);
+	}
+	std::vector<std::uint16_t> indices(sparseCount);
+	std::vector<float> values(sparseCount);
+	for (std::size_t i = 0; i < sparseCount; ++i) {
+		indices[i] = static_cast<std::uint16_t>(i * 7 + 3);
+		values[i] = -static_cast<float>(indices[i]);
+	}
+
+	fastgltf::Asset asset;
+	auto addBufferView = [&](const void* data, std::size_t size) {
+		asset.buffers.emplace_back();
+		asset.buffers.back().byteLength = size;
+		asset.buffers.back().data = fastgltf::sources::ByteView { fastgltf::span(static_cast<const std::byte*>(data), size) };
+		asset.bufferViews.emplace_back();
+		asset.bufferViews.back().bufferIndex = asset.buffers.size() - 1;
+		asset.bufferViews.back().byteLength = size;
+	};
+	addBufferView(dense.data(), dense.size() * sizeof(float));
+	addBufferView(indices.data(), indices.size() * sizeof(std::uint16_t));
+	addBufferView(values.data(), values.size() * sizeof(float));
+
+	auto& accessor = asset.accessors.emplace_back();
+	accessor.bufferViewIndex = 0;
+	accessor.count = count;
+	accessor.type = fastgltf::AccessorType::Scalar;
+	accessor.componentType = fastgltf::ComponentType::Float;
+	fastgltf::SparseAccessor sparse {};
+	sparse.count = sparseCount;
+	sparse.indicesBufferView = 1;
+	sparse.indexComponentType = fastgltf::ComponentType::UnsignedShort;
+	sparse.valuesBufferView = 2;
+	accessor.sparse = sparse;
+
+	fastgltf::SparseAccessorLookup lookup(asset, accessor);
+	REQUIRE(lookup.valid());
+	REQUIRE(lookup.memoryUsage() == ((count + 63) / 64) * (sizeof(std::uint64_t) + sizeof(std::uint32_t)));
+	for (std::size_t i = 0; i < count; ++i) {
+		std::size_t sparseIndex = 0;
+		const bool isSparse = i % 7 == 3 && i / 7 < sparseCount;
+		REQUIRE(lookup.find(i, sparseIndex) == isSparse);
+		if (isSparse)
+			REQUIRE(sparseIndex == i / 7);
+
+		auto element = fastgltf::getAccessorElement<float>(asset, accessor, i, lookup);
+		REQUIRE(element == (isSparse ? -static_cast<float>(i) : static_cast<float>(i)));
+		REQUIRE(element == fastgltf::getAccessorElement<float>(asset, accessor, i));
+	}
+
+	// Sparse indices which are not strictly increasing are invalid, which leaves the lookup empty.
+	std::swap(indices[10], indices[11]);
+	fastgltf::SparseAccessorLookup invalidLookup(asset, accessor);
+	REQUIRE(!invalidLookup.valid());
+	REQUIRE(invalidLookup.memoryUsage() == 0);
+	REQUIRE(fastgltf::getAccessorElement<float>(asset, accessor, 0, invalidLookup) == 0.0f);
+}
+
+TEST_CASE("Test morph target blending", "[gltf-tools]") {
+	constexpr std::size_t count = 1000;
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+	// A tightly packed float target, an interleaved normalized short target, a sparse target without
+	// a buffer view, and a float target where every fifth element is replaced by a sparse value.
+	std::vector<float> floats(count * 3);
+	for (auto& value : floats)
+		value = distribution(gen);
+	std::vector<std::int16_t> shorts(count * 4);
+	for (auto& value : shorts)
+		value = static_cast<std::int16_t>(std::uniform_int_distribution<int>(-32767, 32767)(gen));
+	std::vector<std::uint16_t> sparseIndices;
+	std::vector<std::uint32_t> denseSparseIndices;
+	std::vector<float> sparseValues;
+	for (std::size_t i = 0; i < count / 5; ++i) {
+		sparseIndices.emplace_back(static_cast<std::uint16_t>(i * 3));
+		denseSparseIndices.emplace_back(static_cast<std::uint32_t>(i * 5 + 1));
+		sparseValues.insert(sparseValues.end(), { distribution(gen), distribution(gen), distribution(gen) });
+	}
+
+	fastgltf::Asset asset;
+	auto addBufferView = [&](const void* data, std::size_t size, std::size_t stride = 0) {
+		asset.buffers.emplace_back();
+		asset.buffers.back().byteLength = size;
+		asset.buffers.back().data = fastgltf::sources::ByteView { fastgltf::span(static_cast<const std::byte*>(data), size) };
+		asset.bufferViews.emplace_back();
+		asset.bufferViews.back().bufferIndex = asset.buffers.size() - 1;
+		asset.bufferViews.back().byteLength = size;
+		if (stride != 0)
+			asset.bufferViews.back().byteStride = stride;
+		return asset.bufferViews.size() - 1;
+	};
+	auto addAccessor = [&](fastgltf::Optional<std::size_t> bufferView, fastgltf::ComponentType componentType, bool normalized) {
+		auto& accessor = asset.accessors.emplace_back();
+		accessor.bufferViewIndex = bufferView;
+		accessor.count = count;
+		accessor.type = fastgltf::AccessorType::Vec3;
+		accessor.componentType = componentType;
+		accessor.normalized = normalized;
+		return asset.accessors.size() - 1;
+	};
+	const auto floatView = addBufferView(floats.data(), floats.size() * sizeof(float));
+	const auto shortView = addBufferView(shorts.data(), shorts.size() * sizeof(std::int16_t), 4 * sizeof(std::int16_t));
+	const auto indicesView = addBufferView(sparseIndices.data(), sparseIndices.size() * sizeof(std::uint16_t));
+	const auto denseIndicesView = addBufferView(denseSparseIndices.data(), denseSparseIndices.size() * sizeof(std::uint32_t));
+	const auto valuesView = addBufferView(sparseValues.data(), sparseValues.size() * sizeof(float));
+
+	const auto floatAccessor = addAccessor(floatView, fastgltf::ComponentType::Float, false);
+	const auto shortAccessor = addAccessor(shortView, fastgltf::ComponentType::Short, true);
+	const auto sparseAccessor = addAccessor({}, fastgltf::ComponentType::Float, false);
+	asset.accessors.back().sparse = fastgltf::SparseAccessor {
+		sparseIndices.size(), indicesView, 0, valuesView, 0, fastgltf::ComponentType::UnsignedShort };
+	const auto denseSparseAccessor = addAccessor(floatView, fastgltf::ComponentType::Float, false);
+	asset.accessors.back().sparse = fastgltf::SparseAccessor {
+		denseSparseIndices.size(), denseIndicesView, 0, valuesView, 0, fastgltf::ComponentType::UnsignedInt };
+
+	fastgltf::Primitive primitive;
+	for (auto accessorIndex : { floatAccessor, shortAccessor, sparseAccessor, denseSparseAccessor, floatAccessor }) {
+		auto& target = primitive.targets.emplace_back();
+		target.emplace_back(fastgltf::Attribute { "POSITION", accessorIndex });
+	}
+
+	std::vector<fastgltf::math::fvec3> base(count);
+	for (auto& position : base)
+		position = fastgltf::math::fvec3(distribution(gen), distribution(gen), distribution(gen));
+
+	// The last target has a weight of zero and is skipped.
+	const std::vector<float> weights = { 0.5f, -0.25f, 0.75f, 1.f, 0.f };
+	std::vector<fastgltf::math::fvec3> expected = base;
+	for (std::size_t i = 0; i < weights.size(); ++i) {
+		const auto& accessor = asset.accessors[primitive.targets[i].front().accessorIndex];
+		for (std::size_t j = 0; j < count; ++j) {
+			expected[j] += fastgltf::getAccessorElement<fastgltf::math::fvec3>(asset, accessor, j) * weights[i];
+		}
+	}
+
+	auto blended = base;
+	fastgltf::blendMorphTargets(asset, primitive, "POSITION", fastgltf::span<const float>(weights.data(), weights.size()),
+		fastgltf::span<fastgltf::math::fvec3>(blended.data(), blended.size()));
+	for (std::size_t i = 0; i < count; ++i) {
+		for (std::size_t j = 0; j < 3; ++j)
+			REQUIRE(blended[i][j] == Catch::Approx(expected[i][j]).margin(1e-5));
+	}
+
+	// Attributes without any targets are left untouched.
+	auto normals = base;
+	fastgltf::blendMorphTargets(asset, primitive, "NORMAL", fastgltf::span<const float>(weights.data(), weights.size()),
+		fastgltf::span<fastgltf::math::fvec3>(normals.data(), normals.size()));
+	REQUIRE(normals == base);
+
+	// Use a count which is not a multiple of any vector width to also test the remainders.
+	const auto kernelCount = floats.size() - 5;
+	std::vector<float> expectedSums(kernelCount);
+	for (std::size_t i = 0; i < kernelCount; ++i)
+		expectedSums[i] = 1.f + 0.5f * floats[i];
+	std::vector<float> sums(kernelCount, 1.f);
+	fastgltf::internal::fallback_multiply_add(floats.data(), sums.data(), kernelCount, 0.5f);
+	REQUIRE(sums == expectedSums);
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_IX86)
+	std::fill(sums.begin(), sums.end(), 1.f);
+	fastgltf::internal::sse4_multiply_add(floats.data(), sums.data(), kernelCount, 0.5f);
+	REQUIRE(sums == expectedSums);
+	std::fill(sums.begin(), sums.end(), 1.f);
+	fastgltf::internal::avx2_multiply_add(floats.data(), sums.data(), kernelCount, 0.5f);
+	REQUIRE(sums == expectedSums);
+
+	// A weight which is not a power of two, so that a fused multiply-add would round differently.
+	std::vector<float> sse4Sums(kernelCount, 1.f);
+	std::vector<float> avx2Sums(kernelCount, 1.f);
+	fastgltf::internal::sse4_multiply_add(floats.data(), sse4Sums.data(), kernelCount, 0.3f);
+	fastgltf::internal::avx2_multiply_add(floats.data(), avx2Sums.data(), kernelCount, 0.3f);
+	REQUIRE(avx2Sums == sse4Sums);
+#endif
+#if defined(__aarch64__)
+	std::fill(sums.begin(), sums.end(), 1.f);
+	fastgltf::internal::neon_multiply_add(floats.data(), sums.data(), kernelCount, 0.5f);
+	for (std::size_t i = 0; i < kernelCount; ++i)
+		REQUIRE(sums[i] == Catch::Approx(expectedSums[i]));
+#endif
+}
+
+TEST_CASE("Test caching buffer data adapter", "[gltf-tools]") {
+	// A file with 64 buffer views of 256 floats each, which holds the index of every float.
+	constexpr std::size_t viewCount = 64;
+	constexpr std::size_t viewSize = 256;
+	const auto directory = std::filesystem::temp_directory_path();
+	{
+		std::vector<float> floats(viewCount * viewSize);
+		for (std::size_t i = 0; i < floats.size(); ++i) {
+			floats[i] = static_cast<float>(i);
+		}
+		std::ofstream file(directory / "caching_adapter_test.bin", std::ios::binary);
+		REQUIRE(file.is_open());
+		file.write(reinterpret_cast<const char*>(floats.data()), static_cast<std::streamsize>(floats.size() * sizeof(float)));
+	}
+
+	fastgltf::Asset asset;
+	{
+		auto& buffer = asset.buffers.emplace_back();
+		buffer.byteLength = viewCount * viewSize * sizeof(float);
+		buffer.data = fastgltf::sources::URI { 0, fastgltf::URI(std::string_view("caching_adapter_test.bin")) };
+	}
+	for (std::size_t i = 0; i < viewCount; ++i) {
+		auto& bufferView = asset.bufferViews.emplace_back();
+		bufferView.bufferIndex = 0;
+		bufferView.byteOffset = i * viewSize * sizeof(float);
+		bufferView.byteLength = viewSize * sizeof(float);
+
+		auto& accessor = asset.accessors.emplace_back();
+		accessor.bufferViewIndex = i;
+		accessor.count = viewSize;
+		accessor.type = fastgltf::AccessorType::Scalar;
+		accessor.componentType = fastgltf::ComponentType::Float;
+	}
+
+	// The index sequence 0 1 51 2 49 1000, compressed with EXT_meshopt_compression, using a fallback buffer.
+	const std::uint8_t sequence[] = { 0xD1, 0x00, 0x04, 0xCD, 0x01, 0x04, 0x07, 0x98, 0x1F, 0x00, 0x00, 0x00, 0x00 };
+	{
+		auto& compressedBuffer = asset.buffers.emplace_back();
+		compressedBuffer.byteLength = sizeof sequence;
+		compressedBuffer.data = fastgltf::sources::ByteView { fastgltf::span(reinterpret_cast<const std::byte*>(sequence), sizeof sequence) };
+		auto& fallbackBuffer = asset.buffers.emplace_back();
+		fallbackBuffer.byteLength = 6 * sizeof(std::uint32_t);
+		fallbackBuffer.data = fastgltf::sources::Fallback {};
+
+		auto& bufferView = asset.bufferViews.emplace_back();
+		bufferView.bufferIndex = 2;
+		bufferView.byteLength = 6 * sizeof(std::uint32_t);
+		bufferView.meshoptCompression = std::make_unique<fastgltf::CompressedBufferView>();
+		bufferView.meshoptCompression->bufferIndex = 1;
+		bufferView.meshoptCompression->byteOffset = 0;
+		bufferView.meshoptCompression->byteLength = sizeof sequence;
+		bufferView.meshoptCompression->count = 6;
+		bufferView.meshoptCompression->byteStride = sizeof(std::uint32_t);
+		bufferView.meshoptCompression->mode = fastgltf::MeshoptCompressionMode::Indices;
+		bufferView.meshoptCompression->filter = fastgltf::MeshoptCompressionFilter::None;
+
+		auto& accessor = asset.accessors.emplace_back();
+		accessor.bufferViewIndex = viewCount;
+		accessor.count = 6;
+		accessor.type = fastgltf::AccessorType::Scalar;
+		accessor.componentType = fastgltf::ComponentType::UnsignedInt;
+	}
+
+	// Two floats in a data URI, 1.5 and -2.0.
+	{
+		auto& buffer = asset.buffers.emplace_back();
+		buffer.byteLength = 2 * sizeof(float);
+		buffer.data = fastgltf::sources::URI { 0, fastgltf::URI(std::string_view("data:application/octet-stream;base64,AADAPwAAAMA=")) };
+
+		auto& bufferView = asset.bufferViews.emplace_back();
+		bufferView.bufferIndex = 3;
+		bufferView.byteLength = 2 * sizeof(float);
+
+		auto& accessor = asset.accessors.emplace_back();
+		accessor.bufferViewIndex = viewCount + 1;
+		accessor.count = 2;
+		accessor.type = fastgltf::AccessorType::Scalar;
+		accessor.componentType = fastgltf::ComponentType::Float;
+	}
+
+	// With a budget of a single buffer view, only the most recently used view is kept.
+	fastgltf::CachingBufferDataAdapter adapter(directory, viewSize * sizeof(float));
+	REQUIRE(adapter.memoryUsage() == 0);
+	for (std::size_t i = 0; i < viewCount; ++i) {
+		std::size_t checked = 0;
+		fastgltf::iterateAccessorWithIndex<float>(asset, asset.accessors[i], [&](float value, std::size_t idx) {
+			REQUIRE(value == static_cast<float>(i * viewSize + idx));
+			++checked;
+		}, adapter);
+		REQUIRE(checked == viewSize);
+	}
+	REQUIRE(adapter.memoryUsage() == viewSize * sizeof(float));
+
+	// Data which is still referenced stays valid after it has been evicted.
+	auto firstView = adapter(asset, 0);
+	for (std::size_t i = 1; i < viewCount; ++i) {
+		REQUIRE(adapter(asset, i).size() == viewSize * sizeof(float));
+	}
+	REQUIRE(adapter.memoryUsage() == viewSize * sizeof(float));
+	REQUIRE(firstView.size() == viewSize * sizeof(float));
+	for (std::size_t i = 0; i < viewSize; ++i) {
+		float value;
+		std::memcpy(&value, firstView.subspan(i * sizeof(float)).data(), sizeof value);
+		REQUIRE(value == static_cast<float>(i));
+	}
+
+	std::uint32_t indices[6];
+	fastgltf::copyFromAccessor<std::uint32_t>(asset, asset.accessors[viewCount], indices, adapter);
+	const std::uint32_t expectedIndices[] = { 0, 1, 51, 2, 49, 1000 };
+	REQUIRE(std::memcmp(indices, expectedIndices, sizeof indices) == 0);
+
+	REQUIRE(fastgltf::getAccessorElement<float>(asset, asset.accessors[viewCount + 1], 0, adapter) == 1.5f);
+	REQUIRE(fastgltf::getAccessorElement<float>(asset, asset.accessors[viewCount + 1], 1, adapter) == -2.0f);
+
+	// Copies of the adapter share the cache, and clearing it has to reload the data from the file.
+	auto copy = adapter;
+	copy.clear();
+	REQUIRE(adapter.memoryUsage() == 0);
+	REQUIRE(fastgltf::getAccessorElement<float>(asset, asset.accessors[3], 5, copy) == static_cast<float>(3 * viewSize + 5));
+
+	// Buffer views larger than the budget are not cached at all.
+	fastgltf::CachingBufferDataAdapter smallAdapter(directory, sizeof(float));
+	REQUIRE(fastgltf::getAccessorElement<float>(asset, asset.accessors[7], 3, smallAdapter) == static_cast<float>(7 * viewSize + 3));
+	REQUIRE(smallAdapter.memoryUsage() == 0);
+
+	// A large budget keeps everything, also when used from multiple threads at once. A small budget
+	// evicts data while other threads are still using it.
+	fastgltf::CachingBufferDataAdapter largeAdapter(directory);
+	fastgltf::CachingBufferDataAdapter evictingAdapter(directory, 2 * viewSize * sizeof(float));
+	std::atomic<bool> mismatch = false;
+	std::vector<std::thread> threads;
+	for (std::size_t t = 0; t < 4; ++t) {
+		threads.emplace_back([&, t]() {
+			for (std::size_t i = t; i < viewCount; i += 2) {
+				std::vector<float> values(viewSize);
+				fastgltf::copyFromAccessor<float>(asset, asset.accessors[i], values.data(), largeAdapter);
+				for (std::size_t j = 0; j < viewSize; ++j) {
+					if (values[j] != static_cast<float>(i * viewSize + j))
+						mismatch = true;
+				}
+				fastgltf::iterateAccessorWithIndex<float>(asset, asset.accessors[i], [&](float value, std::size_t idx) {
+					if (value != static_cast<float>(i * viewSize + idx))
+						mismatch = true;
+				}, evictingAdapter);
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	REQUIRE(!mismatch);
+	REQUIRE(largeAdapter.memoryUsage() == viewCount * viewSize * sizeof(float));
+	REQUIRE(evictingAdapter.memoryUsage() <= 2 * viewSize * sizeof(float));
+
+	std::filesystem::remove(directory / "caching_adapter_test.bin");
+}
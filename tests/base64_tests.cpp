@@ -1,5 +1,7 @@
 #include <fstream>
+#include <random>
 #include <sstream>
+#include <thread>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
@@ -64,6 +66,37 @@ TEST_CASE("Check big base64 data decoding", "[base64]") {
     REQUIRE(bytes == decodedBytes);
 }
 
+TEST_CASE("Check parallel base64 decoding", "[base64]") {
+	std::string base64Characters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	// Generate a buffer spanning a few chunks, with the last one being partial and padded.
+	std::mt19937 gen(1337);
+	std::uniform_int_distribution<std::size_t> distribution(0, base64Characters.size() - 1);
+	std::string generatedData(fastgltf::base64::parallelDecodeChunkSize * 5 + 1000, 'A');
+	for (auto& c : generatedData)
+		c = base64Characters[distribution(gen)];
+	generatedData.replace(generatedData.size() - 2, 2, "==");
+
+	auto parallelCallback = [](std::size_t taskCount, void (*task)(std::size_t, void*), void* taskData, void* userPointer) {
+		*static_cast<std::size_t*>(userPointer) = taskCount;
+		std::vector<std::thread> threads;
+		for (std::size_t i = 0; i < taskCount; ++i)
+			threads.emplace_back(task, i, taskData);
+		for (auto& thread : threads)
+			thread.join();
+	};
+
+	auto padding = fastgltf::base64::getPadding(generatedData);
+	REQUIRE(padding == 2);
+	auto expected = fastgltf::base64::fallback_decode(generatedData);
+
+	std::size_t taskCount = 0;
+	fastgltf::StaticVector<std::uint8_t> output(fastgltf::base64::getOutputSize(generatedData.size(), padding));
+	fastgltf::base64::parallel_decode_inplace(generatedData, output.data(), padding, parallelCallback, &taskCount);
+	REQUIRE(taskCount == 5);
+	REQUIRE(output == expected);
+}
+
 TEST_CASE("Test base64 buffer decoding", "[base64]") {
     fastgltf::Parser parser;
     fastgltf::Image texture;
@@ -1,5 +1,8 @@
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -15,6 +18,7 @@
 #include <fastgltf/core.hpp>
 #include <fastgltf/types.hpp>
 #include <fastgltf/math.hpp>
+#include <fastgltf/tools.hpp>
 #include "gltf_path.hpp"
 #include <simdjson.h>
 
@@ -308,6 +312,249 @@ TEST_CASE("Validate models with re-used parser", "[gltf-loader]") {
 	}
 }
 
+TEST_CASE("Test parallel category parsing", "[gltf-loader]") {
+	auto sponza = sampleModels / "2.0" / "Sponza" / "glTF";
+	fastgltf::GltfFileStream jsonData(sponza / "Sponza.gltf");
+	REQUIRE(jsonData.isOpen());
+
+	auto parallelCallback = [](std::size_t taskCount, void (*task)(std::size_t, void*), void* taskData, void* userPointer) {
+		(*static_cast<std::size_t*>(userPointer))++;
+		std::vector<std::thread> threads;
+		for (std::size_t i = 0; i < taskCount; ++i)
+			threads.emplace_back(task, i, taskData);
+		for (auto& thread : threads)
+			thread.join();
+	};
+
+	constexpr auto options = fastgltf::Options::LoadExternalBuffers | fastgltf::Options::LoadExternalImages;
+	fastgltf::Parser serialParser;
+	auto serial = serialParser.loadGltfJson(jsonData, sponza, options);
+	REQUIRE(serial.error() == fastgltf::Error::None);
+
+	std::size_t callbackCounter = 0;
+	fastgltf::Parser parallelParser;
+	parallelParser.setUserPointer(&callbackCounter);
+	parallelParser.setParallelTaskCallback(parallelCallback);
+	auto parallel = parallelParser.loadGltfJson(jsonData, sponza, options);
+	REQUIRE(parallel.error() == fastgltf::Error::None);
+	REQUIRE(fastgltf::validate(parallel.get()) == fastgltf::Error::None);
+
+	// Once for parsing the categories, and once for loading the external files.
+	REQUIRE(callbackCounter == 2);
+
+	REQUIRE(parallel->availableCategories == serial->availableCategories);
+	REQUIRE(parallel->accessors.size() == serial->accessors.size());
+	for (std::size_t i = 0; i < serial->accessors.size(); ++i) {
+		REQUIRE(parallel->accessors[i].name == serial->accessors[i].name);
+		REQUIRE(parallel->accessors[i].count == serial->accessors[i].count);
+		REQUIRE(parallel->accessors[i].bufferViewIndex == serial->accessors[i].bufferViewIndex);
+	}
+	REQUIRE(parallel->buffers.size() == serial->buffers.size());
+	REQUIRE(parallel->bufferViews.size() == serial->bufferViews.size());
+	REQUIRE(parallel->images.size() == serial->images.size());
+	for (std::size_t i = 0; i < serial->images.size(); ++i) {
+		auto* serialArray = std::get_if<fastgltf::sources::Array>(&serial->images[i].data);
+		auto* parallelArray = std::get_if<fastgltf::sources::Array>(&parallel->images[i].data);
+		REQUIRE(serialArray != nullptr);
+		REQUIRE(parallelArray != nullptr);
+		REQUIRE(parallelArray->mimeType == serialArray->mimeType);
+		REQUIRE(parallelArray->bytes.size() == serialArray->bytes.size());
+	}
+	REQUIRE(parallel->materials.size() == serial->materials.size());
+	REQUIRE(parallel->meshes.size() == serial->meshes.size());
+	for (std::size_t i = 0; i < serial->meshes.size(); ++i) {
+		REQUIRE(parallel->meshes[i].name == serial->meshes[i].name);
+		REQUIRE(parallel->meshes[i].primitives.size() == serial->meshes[i].primitives.size());
+	}
+	REQUIRE(parallel->nodes.size() == serial->nodes.size());
+	REQUIRE(parallel->textures.size() == serial->textures.size());
+}
+
+TEST_CASE("Test deferred external file error order", "[gltf-loader]") {
+	auto parallelCallback = [](std::size_t taskCount, void (*task)(std::size_t, void*), void* taskData, void*) {
+		for (std::size_t i = 0; i < taskCount; ++i)
+			task(i, taskData);
+	};
+
+	// The missing buffer file and the invalid accessor have to be reported in document order.
+	constexpr std::string_view bufferFirst = R"({"asset":{"version":"2.0"},
+		"buffers":[{"uri":"missing.bin","byteLength":4}],
+		"accessors":[{"componentType":5126,"count":"invalid","type":"SCALAR"}]})";
+	constexpr std::string_view accessorFirst = R"({"asset":{"version":"2.0"},
+		"accessors":[{"componentType":5126,"count":"invalid","type":"SCALAR"}],
+		"buffers":[{"uri":"missing.bin","byteLength":4}]})";
+
+	for (auto json : { bufferFirst, accessorFirst }) {
+		auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+		REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+		fastgltf::Parser serialParser;
+		auto serial = serialParser.loadGltfJson(jsonData.get(), path, fastgltf::Options::LoadExternalBuffers);
+		REQUIRE(serial.error() != fastgltf::Error::None);
+
+		auto batched = serialParser.loadGltfJson(jsonData.get(), path,
+			fastgltf::Options::LoadExternalBuffers | fastgltf::Options::BatchExternalFileReads);
+		REQUIRE(batched.error() == serial.error());
+
+		fastgltf::Parser parallelParser;
+		parallelParser.setParallelTaskCallback(parallelCallback);
+		auto parallel = parallelParser.loadGltfJson(jsonData.get(), path, fastgltf::Options::LoadExternalBuffers);
+		REQUIRE(parallel.error() == serial.error());
+	}
+}
+
+TEST_CASE("Test on-demand category parsing", "[gltf-loader]") {
+	auto brainStem = sampleModels / "2.0" / "BrainStem" / "glTF";
+	fastgltf::GltfFileStream jsonData(brainStem / "BrainStem.gltf");
+	REQUIRE(jsonData.isOpen());
+
+	fastgltf::Parser parser;
+	fastgltf::Exporter exporter;
+	for (auto categories : { fastgltf::Category::OnlyAnimations, fastgltf::Category::OnlyRenderable,
+							 fastgltf::Category::Buffers | fastgltf::Category::Images, fastgltf::Category::All }) {
+		auto expected = parser.loadGltfJson(jsonData, brainStem, fastgltf::Options::None, categories);
+		REQUIRE(expected.error() == fastgltf::Error::None);
+
+		auto asset = parser.loadGltfJson(jsonData, brainStem, fastgltf::Options::OnDemandParsing, categories);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(asset->availableCategories == expected->availableCategories);
+
+		// Both assets have to be exactly the same, which we check by comparing their exported JSON.
+		auto expectedJson = exporter.writeGltfJson(expected.get());
+		REQUIRE(expectedJson.error() == fastgltf::Error::None);
+		auto json = exporter.writeGltfJson(asset.get());
+		REQUIRE(json.error() == fastgltf::Error::None);
+		REQUIRE(json->output == expectedJson->output);
+	}
+
+	// GltfDataBuffer does not return any padding with the JSON, which the On-Demand parser requires.
+	auto bufferData = fastgltf::GltfDataBuffer::FromPath(brainStem / "BrainStem.gltf");
+	REQUIRE(bufferData.error() == fastgltf::Error::None);
+	auto expected = parser.loadGltfJson(bufferData.get(), brainStem, fastgltf::Options::None, fastgltf::Category::OnlyAnimations);
+	REQUIRE(expected.error() == fastgltf::Error::None);
+	auto asset = parser.loadGltfJson(bufferData.get(), brainStem, fastgltf::Options::OnDemandParsing, fastgltf::Category::OnlyAnimations);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+	REQUIRE(asset->availableCategories == expected->availableCategories);
+	REQUIRE(asset->animations.size() == expected->animations.size());
+}
+
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+TEST_CASE("Test chunk memory resource", "[gltf-loader]") {
+	fastgltf::ChunkMemoryResource resource;
+	resource.reserve(16384);
+	REQUIRE(resource.capacity() == 16384);
+
+	void* first = resource.allocate(100, 16);
+	REQUIRE(reinterpret_cast<std::uintptr_t>(first) % 16 == 0);
+	void* second = resource.allocate(50, 8);
+	REQUIRE(second != first);
+	REQUIRE(reinterpret_cast<std::uintptr_t>(second) % 8 == 0);
+
+	// Allocations larger than the remaining space grow the resource.
+	void* large = resource.allocate(32768, 64);
+	REQUIRE(reinterpret_cast<std::uintptr_t>(large) % 64 == 0);
+	const auto capacity = resource.capacity();
+	REQUIRE(capacity > 16384 + 32768);
+
+	// After a reset, the same memory is handed out again.
+	resource.reset();
+	REQUIRE(resource.allocate(100, 16) == first);
+	REQUIRE(resource.capacity() == capacity);
+
+	// Growing past a large reserved block does not double the reserved size.
+	fastgltf::ChunkMemoryResource reserved;
+	reserved.reserve(1024 * 1024);
+	reserved.allocate(1024 * 1024, 1);
+	reserved.allocate(16, 16);
+	REQUIRE(reserved.capacity() < 1024 * 1024 + 65536);
+}
+
+TEST_CASE("Test memory resource reuse across loads", "[gltf-loader]") {
+	auto brainStem = sampleModels / "2.0" / "BrainStem" / "glTF";
+	fastgltf::GltfFileStream jsonData(brainStem / "BrainStem.gltf");
+	REQUIRE(jsonData.isOpen());
+
+	fastgltf::Parser parser;
+	parser.setMemoryResourceSizeHint(jsonData.totalSize());
+
+	auto expected = parser.loadGltfJson(jsonData, brainStem);
+	REQUIRE(expected.error() == fastgltf::Error::None);
+
+	// Every load reuses the arena of the previous, destroyed asset, while the first asset stays untouched.
+	for (std::size_t i = 0; i < 3; ++i) {
+		auto asset = parser.loadGltfJson(jsonData, brainStem);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(asset->nodes.size() == expected->nodes.size());
+		for (std::size_t j = 0; j < expected->nodes.size(); ++j) {
+			REQUIRE(asset->nodes[j].name == expected->nodes[j].name);
+		}
+		REQUIRE(asset->meshes.size() == expected->meshes.size());
+		for (std::size_t j = 0; j < expected->meshes.size(); ++j) {
+			REQUIRE(asset->meshes[j].primitives.size() == expected->meshes[j].primitives.size());
+			for (std::size_t k = 0; k < expected->meshes[j].primitives.size(); ++k) {
+				auto& attributes = asset->meshes[j].primitives[k].attributes;
+				auto& expectedAttributes = expected->meshes[j].primitives[k].attributes;
+				REQUIRE(attributes.size() == expectedAttributes.size());
+				for (std::size_t l = 0; l < attributes.size(); ++l) {
+					REQUIRE(attributes[l].name == expectedAttributes[l].name);
+				}
+			}
+		}
+	}
+
+	// Assets may be destroyed on another thread, and may outlive the parser which loaded them.
+	auto other = parser.loadGltfJson(jsonData, brainStem);
+	REQUIRE(other.error() == fastgltf::Error::None);
+	std::thread([asset = std::move(other.get())]() mutable {
+		auto destroyed = std::move(asset);
+	}).join();
+	auto reused = parser.loadGltfJson(jsonData, brainStem);
+	REQUIRE(reused.error() == fastgltf::Error::None);
+	REQUIRE(reused->nodes.size() == expected->nodes.size());
+
+	auto outliving = std::make_unique<fastgltf::Parser>();
+	auto asset = outliving->loadGltfJson(jsonData, brainStem);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+	outliving.reset();
+	REQUIRE(asset->nodes.size() == expected->nodes.size());
+}
+#endif
+
+#if FASTGLTF_ENABLE_STATISTICS
+TEST_CASE("Test parse and export statistics", "[gltf-loader]") {
+	auto brainStem = sampleModels / "2.0" / "BrainStem" / "glTF";
+	fastgltf::GltfFileStream jsonData(brainStem / "BrainStem.gltf");
+	REQUIRE(jsonData.isOpen());
+
+	fastgltf::Parser parser;
+	auto asset = parser.loadGltfJson(jsonData, brainStem, fastgltf::Options::LoadExternalBuffers);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+
+	const auto& statistics = parser.getStatistics();
+	REQUIRE(statistics.jsonDuration.count() > 0);
+	REQUIRE(statistics[fastgltf::Category::Nodes].allocationCount != 0);
+	REQUIRE(statistics[fastgltf::Category::Nodes].allocatedBytes >= asset->nodes.size() * sizeof(fastgltf::Node));
+	REQUIRE(statistics[fastgltf::Category::Nodes].duration.count() > 0);
+	REQUIRE(statistics[fastgltf::Category::Buffers].allocatedBytes >= asset->buffers.front().byteLength);
+	REQUIRE(statistics[fastgltf::Category::Cameras].allocationCount == 0);
+
+	// Only the requested categories are parsed, so the others have no statistics.
+	auto partial = parser.loadGltfJson(jsonData, brainStem, fastgltf::Options::None, fastgltf::Category::Buffers);
+	REQUIRE(partial.error() == fastgltf::Error::None);
+	REQUIRE(parser.getStatistics()[fastgltf::Category::Nodes].allocationCount == 0);
+	REQUIRE(parser.getStatistics()[fastgltf::Category::Nodes].duration.count() == 0);
+
+	fastgltf::Exporter exporter;
+	auto json = exporter.writeGltfJson(asset.get());
+	REQUIRE(json.error() == fastgltf::Error::None);
+	std::uint64_t writtenBytes = 0;
+	for (const auto& category : exporter.getStatistics().categories)
+		writtenBytes += category.writtenBytes;
+	REQUIRE(exporter.getStatistics()[fastgltf::Category::Nodes].writtenBytes != 0);
+	REQUIRE(writtenBytes < json->output.size());
+}
+#endif
+
 TEST_CASE("Test allocation callbacks for embedded buffers", "[gltf-loader]") {
     auto boxPath = sampleModels / "2.0" / "Box" / "glTF-Embedded";
 	fastgltf::GltfFileStream jsonData(boxPath / "Box.gltf");
@@ -485,6 +732,224 @@ TEST_CASE("Test accessors min/max", "[gltf-loader]") {
     }
 }
 
+TEST_CASE("Test generating mesh indices", "[gltf-loader]") {
+	// Two triangles sharing an edge, without indices. The first primitive only uses the positions,
+	// while the second primitive also has texture coordinates that differ for one of the shared vertices.
+	constexpr std::string_view json = R"({"asset":{"version":"2.0"},
+		"buffers":[{"byteLength":120,"uri":"data:application/octet-stream;base64,AAAAAAAAAAAAAAAAAACAPwAAAAAAAAAAAAAAAAAAgD8AAAAAAAAAAAAAgD8AAAAAAACAPwAAAAAAAAAAAACAPwAAgD8AAAAAAAAAAAAAAAAAAIA/AAAAAAAAAAAAAIA/AAAAAAAAgD8AAAA/AAAAAAAAgD8AAIA/"}],
+		"bufferViews":[{"buffer":0,"byteLength":72},{"buffer":0,"byteOffset":72,"byteLength":48}],
+		"accessors":[{"bufferView":0,"componentType":5126,"count":6,"type":"VEC3","min":[0,0,0],"max":[1,1,0]},
+			{"bufferView":1,"componentType":5126,"count":6,"type":"VEC2"}],
+		"meshes":[{"primitives":[{"attributes":{"POSITION":0}},{"attributes":{"POSITION":0,"TEXCOORD_0":1}}]}]})";
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	auto getIndices = [](const fastgltf::Asset& asset, const fastgltf::Primitive& primitive) {
+		REQUIRE(primitive.indicesAccessor.has_value());
+		auto& accessor = asset.accessors[*primitive.indicesAccessor];
+		std::vector<std::uint32_t> indices(accessor.count);
+		fastgltf::copyFromAccessor<std::uint32_t>(asset, accessor, indices.data());
+		return indices;
+	};
+
+	fastgltf::Parser parser;
+	SECTION("Trivial indices") {
+		auto asset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::GenerateMeshIndices);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+
+		for (auto& primitive : asset->meshes[0].primitives) {
+			REQUIRE(getIndices(asset.get(), primitive) == std::vector<std::uint32_t> { 0, 1, 2, 3, 4, 5 });
+			REQUIRE(primitive.findAttribute("POSITION")->accessorIndex == 0);
+		}
+
+		// Every primitive has its own accessor, but they share the index sequence in the generated buffer.
+		auto& firstIndices = asset->accessors[*asset->meshes[0].primitives[0].indicesAccessor];
+		auto& secondIndices = asset->accessors[*asset->meshes[0].primitives[1].indicesAccessor];
+		REQUIRE(&firstIndices != &secondIndices);
+		REQUIRE(*firstIndices.bufferViewIndex == *secondIndices.bufferViewIndex);
+		REQUIRE(firstIndices.byteOffset == secondIndices.byteOffset);
+		REQUIRE(asset->buffers.size() == 2);
+		REQUIRE(asset->bufferViews.size() == 3);
+	}
+
+	SECTION("Welded indices") {
+		auto asset = parser.loadGltfJson(jsonData.get(), {},
+			fastgltf::Options::GenerateMeshIndices | fastgltf::Options::WeldGeneratedMeshIndices);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+
+		auto& first = asset->meshes[0].primitives[0];
+		REQUIRE(getIndices(asset.get(), first) == std::vector<std::uint32_t> { 0, 1, 2, 2, 1, 3 });
+		auto& firstPositions = asset->accessors[first.findAttribute("POSITION")->accessorIndex];
+		REQUIRE(firstPositions.count == 4);
+		REQUIRE(std::get<FASTGLTF_STD_PMR_NS::vector<double>>(firstPositions.max)[1] == 1.0);
+
+		std::vector<fastgltf::math::fvec3> positions(firstPositions.count);
+		fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset.get(), firstPositions, positions.data());
+		REQUIRE(positions[0] == fastgltf::math::fvec3(0, 0, 0));
+		REQUIRE(positions[1] == fastgltf::math::fvec3(1, 0, 0));
+		REQUIRE(positions[2] == fastgltf::math::fvec3(0, 1, 0));
+		REQUIRE(positions[3] == fastgltf::math::fvec3(1, 1, 0));
+		REQUIRE(asset->bufferViews[*firstPositions.bufferViewIndex].target == fastgltf::BufferTarget::ArrayBuffer);
+
+		// The differing texture coordinate prevents welding of one of the shared vertices.
+		auto& second = asset->meshes[0].primitives[1];
+		REQUIRE(getIndices(asset.get(), second) == std::vector<std::uint32_t> { 0, 1, 2, 2, 3, 4 });
+		auto& texCoords = asset->accessors[second.findAttribute("TEXCOORD_0")->accessorIndex];
+		REQUIRE(texCoords.count == 5);
+		REQUIRE(asset->accessors[second.findAttribute("POSITION")->accessorIndex].count == 5);
+
+		std::vector<fastgltf::math::fvec2> uvs(texCoords.count);
+		fastgltf::copyFromAccessor<fastgltf::math::fvec2>(asset.get(), texCoords, uvs.data());
+		REQUIRE(uvs[3] == fastgltf::math::fvec2(0.5f, 0));
+		REQUIRE(uvs[4] == fastgltf::math::fvec2(1, 1));
+
+		// The original accessors are left untouched.
+		REQUIRE(asset->accessors[0].count == 6);
+		REQUIRE(asset->accessors[1].count == 6);
+
+		// All welded vertices and indices are written into a single new buffer.
+		REQUIRE(asset->buffers.size() == 2);
+		REQUIRE(*asset->accessors[*first.indicesAccessor].bufferViewIndex == *asset->accessors[*second.indicesAccessor].bufferViewIndex);
+		for (std::size_t i = 2; i < asset->bufferViews.size(); ++i) {
+			REQUIRE(asset->bufferViews[i].bufferIndex == 1);
+		}
+	}
+}
+
+TEST_CASE("Test optimizing meshes", "[gltf-loader]") {
+	// Rotates every triangle so that it starts with its smallest index, keeping the winding, and sorts them.
+	auto normalizeTriangles = [](std::vector<std::array<std::uint32_t, 3>> triangles) {
+		for (auto& triangle : triangles) {
+			std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+		}
+		std::sort(triangles.begin(), triangles.end());
+		return triangles;
+	};
+
+	SECTION("Vertex cache optimization") {
+		// A grid of quads, with the triangles in random order.
+		constexpr std::uint32_t gridSize = 64;
+		std::vector<std::array<std::uint32_t, 3>> triangles;
+		for (std::uint32_t y = 0; y < gridSize; ++y) {
+			for (std::uint32_t x = 0; x < gridSize; ++x) {
+				const auto v = y * (gridSize + 1) + x;
+				triangles.push_back({ v, v + 1, v + gridSize + 1 });
+				triangles.push_back({ v + 1, v + gridSize + 2, v + gridSize + 1 });
+			}
+		}
+		std::shuffle(triangles.begin(), triangles.end(), std::mt19937(1234));
+
+		std::vector<std::uint32_t> indices;
+		for (auto& triangle : triangles)
+			indices.insert(indices.end(), triangle.begin(), triangle.end());
+		constexpr auto vertexCount = (gridSize + 1) * (gridSize + 1);
+
+		const auto before = fastgltf::computeVertexCacheMissRatio(fastgltf::span<const std::uint32_t>(indices.data(), indices.size()), vertexCount);
+		fastgltf::optimizeVertexCache(fastgltf::span<std::uint32_t>(indices.data(), indices.size()), vertexCount);
+		const auto after = fastgltf::computeVertexCacheMissRatio(fastgltf::span<const std::uint32_t>(indices.data(), indices.size()), vertexCount);
+		REQUIRE(before > 2.5f);
+		REQUIRE(after < 0.8f);
+
+		std::vector<std::array<std::uint32_t, 3>> optimizedTriangles(triangles.size());
+		std::memcpy(optimizedTriangles.data(), indices.data(), indices.size() * sizeof(std::uint32_t));
+		REQUIRE(normalizeTriangles(optimizedTriangles) == normalizeTriangles(triangles));
+	}
+
+	SECTION("Optimizing loaded primitives") {
+		// A quad with the indices 3, 1, 2, 2, 1, 0.
+		constexpr std::string_view json = R"({"asset":{"version":"2.0"},
+			"buffers":[{"byteLength":60,"uri":"data:application/octet-stream;base64,AAAAAAAAAAAAAAAAAACAPwAAAAAAAAAAAAAAAAAAgD8AAAAAAACAPwAAgD8AAAAAAwABAAIAAgABAAAA"}],
+			"bufferViews":[{"buffer":0,"byteLength":48},{"buffer":0,"byteOffset":48,"byteLength":12}],
+			"accessors":[{"bufferView":0,"componentType":5126,"count":4,"type":"VEC3","min":[0,0,0],"max":[1,1,0]},
+				{"bufferView":1,"componentType":5123,"count":6,"type":"SCALAR"}],
+			"meshes":[{"primitives":[{"attributes":{"POSITION":0},"indices":1}]}]})";
+		auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+		REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+		fastgltf::Parser parser;
+		auto asset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::OptimizeMeshes);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+		REQUIRE(asset->buffers.size() == 2);
+
+		auto& primitive = asset->meshes[0].primitives[0];
+		auto& indexAccessor = asset->accessors[*primitive.indicesAccessor];
+		REQUIRE(indexAccessor.componentType == fastgltf::ComponentType::UnsignedShort);
+		std::vector<std::uint32_t> indices(indexAccessor.count);
+		fastgltf::copyFromAccessor<std::uint32_t>(asset.get(), indexAccessor, indices.data());
+
+		// The vertices are stored in the order in which they are first used.
+		std::uint32_t nextVertex = 0;
+		for (auto index : indices) {
+			REQUIRE(index <= nextVertex);
+			if (index == nextVertex)
+				++nextVertex;
+		}
+
+		auto& positionAccessor = asset->accessors[primitive.findAttribute("POSITION")->accessorIndex];
+		REQUIRE(positionAccessor.count == 4);
+		REQUIRE(positionAccessor.bufferViewIndex != 0U);
+		std::vector<fastgltf::math::fvec3> positions(positionAccessor.count);
+		fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset.get(), positionAccessor, positions.data());
+
+		// Map the positions back to the original vertices to compare the triangles.
+		const std::array<fastgltf::math::fvec3, 4> originalPositions = {{ { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 1, 1, 0 } }};
+		std::vector<std::array<std::uint32_t, 3>> triangles(indices.size() / 3);
+		for (std::size_t i = 0; i < indices.size(); ++i) {
+			auto it = std::find(originalPositions.begin(), originalPositions.end(), positions[indices[i]]);
+			REQUIRE(it != originalPositions.end());
+			triangles[i / 3][i % 3] = static_cast<std::uint32_t>(std::distance(originalPositions.begin(), it));
+		}
+		REQUIRE(normalizeTriangles(triangles) == normalizeTriangles({ { 3, 1, 2 }, { 2, 1, 0 } }));
+	}
+
+	SECTION("Optimizing quantized primitives") {
+		// The same quad, with i16 positions using KHR_mesh_quantization, which are padded to 8 bytes.
+		constexpr std::string_view json = R"({"asset":{"version":"2.0"},"extensionsUsed":["KHR_mesh_quantization"],"extensionsRequired":["KHR_mesh_quantization"],
+			"buffers":[{"byteLength":44,"uri":"data:application/octet-stream;base64,AAAAAAAAAAABAAAAAAAAAAAAAQAAAAAAAQABAAAAAAADAAEAAgACAAEAAAA="}],
+			"bufferViews":[{"buffer":0,"byteLength":32,"byteStride":8,"target":34962},{"buffer":0,"byteOffset":32,"byteLength":12}],
+			"accessors":[{"bufferView":0,"componentType":5122,"count":4,"type":"VEC3","min":[0,0,0],"max":[1,1,0]},
+				{"bufferView":1,"componentType":5123,"count":6,"type":"SCALAR"}],
+			"meshes":[{"primitives":[{"attributes":{"POSITION":0},"indices":1}]}]})";
+		auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+		REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+		fastgltf::Parser parser(fastgltf::Extensions::KHR_mesh_quantization);
+		auto asset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::OptimizeMeshes);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+
+		auto& primitive = asset->meshes[0].primitives[0];
+		auto& positionAccessor = asset->accessors[primitive.findAttribute("POSITION")->accessorIndex];
+		REQUIRE(positionAccessor.componentType == fastgltf::ComponentType::Short);
+		REQUIRE(positionAccessor.count == 4);
+		REQUIRE(positionAccessor.bufferViewIndex != 0U);
+
+		// The 6 byte elements are written with a stride of 8 bytes, to keep every vertex aligned to 4 bytes.
+		auto& positionView = asset->bufferViews[*positionAccessor.bufferViewIndex];
+		REQUIRE(positionView.byteOffset % 4 == 0);
+		REQUIRE(positionView.byteStride == 8U);
+		REQUIRE(positionView.byteLength == 4 * 8);
+		REQUIRE(positionView.target == fastgltf::BufferTarget::ArrayBuffer);
+
+		std::vector<std::uint32_t> indices(asset->accessors[*primitive.indicesAccessor].count);
+		fastgltf::copyFromAccessor<std::uint32_t>(asset.get(), asset->accessors[*primitive.indicesAccessor], indices.data());
+		std::vector<fastgltf::math::fvec3> positions(positionAccessor.count);
+		fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset.get(), positionAccessor, positions.data());
+
+		const std::array<fastgltf::math::fvec3, 4> originalPositions = {{ { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 1, 1, 0 } }};
+		std::vector<std::array<std::uint32_t, 3>> triangles(indices.size() / 3);
+		for (std::size_t i = 0; i < indices.size(); ++i) {
+			auto it = std::find(originalPositions.begin(), originalPositions.end(), positions[indices[i]]);
+			REQUIRE(it != originalPositions.end());
+			triangles[i / 3][i % 3] = static_cast<std::uint32_t>(std::distance(originalPositions.begin(), it));
+		}
+		REQUIRE(normalizeTriangles(triangles) == normalizeTriangles({ { 3, 1, 2 }, { 2, 1, 0 } }));
+	}
+}
+
 TEST_CASE("Test unicode characters", "[gltf-loader]") {
 #if FASTGLTF_CPP_20
 	auto unicodePath = sampleModels / "2.0" / std::filesystem::path(u8"Unicode❤♻Test") / "glTF";
@@ -599,5 +1064,140 @@ TEST_CASE("Test glTF file loading", "[gltf-loader]") {
 		REQUIRE(asset.error() == fastgltf::Error::None);
 		REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
 	}
+
+	SECTION("Mapped external buffers") {
+		auto cubePath = sampleModels / "2.0" / "Cube" / "glTF";
+		fastgltf::GltfFileStream jsonData(cubePath / "Cube.gltf");
+		REQUIRE(jsonData.isOpen());
+
+		fastgltf::Parser parser;
+		auto loaded = parser.loadGltfJson(jsonData, cubePath, fastgltf::Options::LoadExternalBuffers);
+		REQUIRE(loaded.error() == fastgltf::Error::None);
+		auto* array = std::get_if<fastgltf::sources::Array>(&loaded->buffers.front().data);
+		REQUIRE(array != nullptr);
+
+		auto mapped = parser.loadGltfJson(jsonData, cubePath,
+			fastgltf::Options::LoadExternalBuffers | fastgltf::Options::LoadExternalImages | fastgltf::Options::MapExternalFiles);
+		REQUIRE(mapped.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(mapped.get()) == fastgltf::Error::None);
+
+		auto* byteView = std::get_if<fastgltf::sources::ByteView>(&mapped->buffers.front().data);
+		REQUIRE(byteView != nullptr);
+		REQUIRE(byteView->bytes.size() == array->bytes.size());
+		REQUIRE(std::memcmp(byteView->bytes.data(), array->bytes.data(), array->bytes.size()) == 0);
+
+		for (auto& image : mapped->images) {
+			auto* imageView = std::get_if<fastgltf::sources::ByteView>(&image.data);
+			REQUIRE(imageView != nullptr);
+		}
+	}
+
+	SECTION("Share mappings between buffers") {
+		auto cubePath = sampleModels / "2.0" / "Cube" / "glTF";
+		constexpr std::string_view json = R"({"asset":{"version":"2.0"},"buffers":[{"uri":"Cube.bin","byteLength":1800},{"uri":"./Cube.bin","byteLength":1800}]})";
+		auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+		REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+		fastgltf::Parser parser;
+		auto asset = parser.loadGltfJson(jsonData.get(), cubePath, fastgltf::Options::LoadExternalBuffers | fastgltf::Options::MapExternalFiles);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(asset->buffers.size() == 2);
+
+		auto* first = std::get_if<fastgltf::sources::ByteView>(&asset->buffers[0].data);
+		auto* second = std::get_if<fastgltf::sources::ByteView>(&asset->buffers[1].data);
+		REQUIRE(first != nullptr);
+		REQUIRE(second != nullptr);
+		REQUIRE(first->bytes.data() == second->bytes.data());
+	}
+}
+#endif
+
+#if defined(FASTGLTF_HAS_IO_URING)
+TEST_CASE("Test io_uring file loading", "[gltf-loader]") {
+	SECTION("Load glTF") {
+		auto cubePath = sampleModels / "2.0" / "Cube" / "glTF";
+		auto file = fastgltf::IoUringGltfFile::FromPath(cubePath / "Cube.gltf");
+		REQUIRE(file.error() == fastgltf::Error::None);
+
+		REQUIRE(fastgltf::determineGltfFileType(file.get()) == fastgltf::GltfType::glTF);
+
+		fastgltf::Parser parser;
+		auto asset = parser.loadGltfJson(file.get(), cubePath);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+	}
+
+	SECTION("Load GLB") {
+		auto boxPath = sampleModels / "2.0" / "Box" / "glTF-Binary";
+		auto file = fastgltf::IoUringGltfFile::FromPath(boxPath / "Box.glb");
+		REQUIRE(file.error() == fastgltf::Error::None);
+
+		fastgltf::Parser parser;
+		auto asset = parser.loadGltfBinary(file.get(), boxPath);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+
+		auto copiedData = fastgltf::GltfDataBuffer::FromPath(boxPath / "Box.glb");
+		REQUIRE(copiedData.error() == fastgltf::Error::None);
+		auto expected = parser.loadGltfBinary(copiedData.get(), boxPath);
+		REQUIRE(expected.error() == fastgltf::Error::None);
+
+		auto* array = std::get_if<fastgltf::sources::Array>(&asset->buffers.front().data);
+		auto* expectedArray = std::get_if<fastgltf::sources::Array>(&expected->buffers.front().data);
+		REQUIRE(array != nullptr);
+		REQUIRE(expectedArray != nullptr);
+		REQUIRE(array->bytes == expectedArray->bytes);
+	}
+
+	SECTION("Read past the end") {
+		auto cubePath = sampleModels / "2.0" / "Cube" / "glTF";
+		auto file = fastgltf::IoUringGltfFile::FromPath(cubePath / "Cube.gltf");
+		REQUIRE(file.error() == fastgltf::Error::None);
+
+		const auto size = file->totalSize();
+		file->skip(size + 16);
+		std::byte byte {};
+		file->read(&byte, 1);
+		REQUIRE(file->bytesRead() == size + 16);
+		REQUIRE(file->readError() == fastgltf::Error::None);
+
+		// A moved-from file has no ring and no file descriptor left, and must report an error instead of crashing.
+		auto moved = std::move(file.get());
+		file->reset();
+		auto bytes = file->read(4, 0);
+		REQUIRE(bytes.size() == 4);
+		REQUIRE(file->readError() == fastgltf::Error::InvalidPath);
+		REQUIRE(moved.readError() == fastgltf::Error::None);
+	}
+
+	SECTION("Batch external file reads") {
+		auto cubePath = sampleModels / "2.0" / "Cube" / "glTF";
+		fastgltf::GltfFileStream jsonData(cubePath / "Cube.gltf");
+		REQUIRE(jsonData.isOpen());
+
+		constexpr auto loadOptions = fastgltf::Options::LoadExternalBuffers | fastgltf::Options::LoadExternalImages;
+		fastgltf::Parser parser;
+		auto expected = parser.loadGltfJson(jsonData, cubePath, loadOptions);
+		REQUIRE(expected.error() == fastgltf::Error::None);
+
+		auto batched = parser.loadGltfJson(jsonData, cubePath, loadOptions | fastgltf::Options::BatchExternalFileReads);
+		REQUIRE(batched.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(batched.get()) == fastgltf::Error::None);
+
+		REQUIRE(batched->buffers.size() == expected->buffers.size());
+		for (std::size_t i = 0; i < expected->buffers.size(); ++i) {
+			auto* array = std::get_if<fastgltf::sources::Array>(&batched->buffers[i].data);
+			REQUIRE(array != nullptr);
+			REQUIRE(array->bytes == std::get<fastgltf::sources::Array>(expected->buffers[i].data).bytes);
+		}
+		REQUIRE(batched->images.size() == expected->images.size());
+		for (std::size_t i = 0; i < expected->images.size(); ++i) {
+			auto* array = std::get_if<fastgltf::sources::Array>(&batched->images[i].data);
+			REQUIRE(array != nullptr);
+			auto& expectedArray = std::get<fastgltf::sources::Array>(expected->images[i].data);
+			REQUIRE(array->bytes == expectedArray.bytes);
+			REQUIRE(array->mimeType == expectedArray.mimeType);
+		}
+	}
 }
 #endif
@@ -1,5 +1,9 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <fstream>
 #include <random>
+#include <string>
 
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -8,6 +12,7 @@
 
 #include <fastgltf/core.hpp>
 #include <fastgltf/base64.hpp>
+#include <fastgltf/tools.hpp>
 #include "gltf_path.hpp"
 
 constexpr auto benchmarkOptions = fastgltf::Options::DontRequireValidAssetMember;
@@ -340,6 +345,40 @@ TEST_CASE("Compare parsing performance with minified documents", "[gltf-benchmar
     };
 }
 
+TEST_CASE("Compare on-demand parsing performance", "[gltf-benchmark]") {
+	// A large document, of which only the small materials array is requested.
+	std::string json = R"({"asset":{"version":"2.0"},"materials":[{"name":"material"}],"nodes":[)";
+	for (std::size_t i = 0; i < 100000; ++i) {
+		if (i != 0)
+			json += ',';
+		json += R"({"name":"node)" + std::to_string(i) + R"(","translation":[1.0,2.0,3.0],"rotation":[0.0,0.0,0.0,1.0]})";
+	}
+	json += R"(],"accessors":[)";
+	for (std::size_t i = 0; i < 100000; ++i) {
+		if (i != 0)
+			json += ',';
+		json += R"({"bufferView":0,"componentType":5126,"count":3,"type":"VEC3","max":[1.0,1.0,1.0],"min":[0.0,0.0,0.0]})";
+	}
+	json += "]}";
+
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	fastgltf::Parser parser;
+	auto onDemand = parser.loadGltfJson(jsonData.get(), {}, benchmarkOptions | fastgltf::Options::OnDemandParsing, fastgltf::Category::Materials);
+	REQUIRE(onDemand.error() == fastgltf::Error::None);
+	REQUIRE(onDemand->materials.size() == 1);
+	REQUIRE(onDemand->nodes.empty());
+
+	BENCHMARK("Parse only materials with the DOM parser") {
+		return parser.loadGltfJson(jsonData.get(), {}, benchmarkOptions, fastgltf::Category::Materials);
+	};
+
+	BENCHMARK("Parse only materials with on-demand pruning") {
+		return parser.loadGltfJson(jsonData.get(), {}, benchmarkOptions | fastgltf::Options::OnDemandParsing, fastgltf::Category::Materials);
+	};
+}
+
 TEST_CASE("Small CRC32-C benchmark", "[gltf-benchmark]") {
     static constexpr std::string_view test = "abcdefghijklmnopqrstuvwxyz";
     BENCHMARK("Default 1-byte tabular algorithm") {
@@ -427,3 +466,455 @@ TEST_CASE("Compare base64 decoding performance", "[gltf-benchmark]") {
 	}
 #endif
 }
+
+TEST_CASE("Compare accessor element reading performance", "[gltf-benchmark]") {
+	// A quantized, interleaved vertex buffer with normalized 16-bit positions padded to 8 bytes.
+	constexpr std::size_t vertexCount = 1024 * 1024;
+	constexpr std::size_t stride = 8;
+
+	std::random_device device;
+	std::mt19937 gen(device());
+	std::uniform_int_distribution<std::uint32_t> distribution(0, 255);
+	std::vector<std::byte> data(vertexCount * stride);
+	for (auto& byte : data) {
+		byte = static_cast<std::byte>(distribution(gen));
+	}
+
+	fastgltf::Asset asset;
+	asset.buffers.emplace_back();
+	asset.buffers.back().byteLength = data.size();
+	asset.buffers.back().data = fastgltf::sources::ByteView { fastgltf::span<const std::byte>(data.data(), data.size()) };
+	asset.bufferViews.emplace_back();
+	asset.bufferViews.back().bufferIndex = 0;
+	asset.bufferViews.back().byteLength = data.size();
+	asset.bufferViews.back().byteStride = stride;
+
+	auto& positions = asset.accessors.emplace_back();
+	positions.bufferViewIndex = 0;
+	positions.count = vertexCount;
+	positions.type = fastgltf::AccessorType::Vec3;
+	positions.componentType = fastgltf::ComponentType::UnsignedShort;
+	positions.normalized = true;
+
+	std::vector<fastgltf::math::fvec3> output(vertexCount);
+	auto bytes = fastgltf::DefaultBufferDataAdapter()(asset, 0);
+
+	// This is how iterateAccessor used to read every element, switching over the component type each time.
+	BENCHMARK("Read elements with getAccessorElementAt") {
+		for (std::size_t i = 0; i < vertexCount; ++i) {
+			output[i] = fastgltf::internal::getAccessorElementAt<fastgltf::math::fvec3>(
+				positions.componentType, &bytes[i * stride], positions.normalized);
+		}
+		return output.back();
+	};
+
+	BENCHMARK("Read elements with iterateAccessorWithIndex") {
+		fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec3>(asset, positions, [&](fastgltf::math::fvec3 position, std::size_t i) {
+			output[i] = position;
+		});
+		return output.back();
+	};
+
+	BENCHMARK("Read elements with copyFromAccessor") {
+		fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset, positions, output.data());
+		return output.back();
+	};
+}
+
+TEST_CASE("Compare sparse accessor copy performance", "[gltf-benchmark]") {
+	// A morph target without a buffer view, which displaces every tenth vertex of a large mesh.
+	constexpr std::size_t vertexCount = 1024 * 1024;
+	constexpr std::size_t sparseCount = vertexCount / 10;
+
+	std::random_device device;
+	std::mt19937 gen(device());
+	std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+	std::vector<std::uint32_t> indices(sparseCount);
+	std::vector<fastgltf::math::fvec3> values(sparseCount);
+	for (std::size_t i = 0; i < sparseCount; ++i) {
+		indices[i] = static_cast<std::uint32_t>(i * 10);
+		values[i] = fastgltf::math::fvec3(distribution(gen), distribution(gen), distribution(gen));
+	}
+
+	fastgltf::Asset asset;
+	asset.buffers.emplace_back();
+	asset.buffers.back().byteLength = indices.size() * sizeof(std::uint32_t);
+	asset.buffers.back().data = fastgltf::sources::ByteView { fastgltf::span(reinterpret_cast<const std::byte*>(indices.data()), indices.size() * sizeof(std::uint32_t)) };
+	asset.buffers.emplace_back();
+	asset.buffers.back().byteLength = values.size() * sizeof(fastgltf::math::fvec3);
+	asset.buffers.back().data = fastgltf::sources::ByteView { fastgltf::span(reinterpret_cast<const std::byte*>(values.data()), values.size() * sizeof(fastgltf::math::fvec3)) };
+	for (std::size_t i = 0; i < 2; ++i) {
+		asset.bufferViews.emplace_back();
+		asset.bufferViews.back().bufferIndex = i;
+		asset.bufferViews.back().byteLength = asset.buffers[i].byteLength;
+	}
+
+	auto& displacements = asset.accessors.emplace_back();
+	displacements.count = vertexCount;
+	displacements.type = fastgltf::AccessorType::Vec3;
+	displacements.componentType = fastgltf::ComponentType::Float;
+	fastgltf::SparseAccessor sparse {};
+	sparse.count = sparseCount;
+	sparse.indicesBufferView = 0;
+	sparse.indexComponentType = fastgltf::ComponentType::UnsignedInt;
+	sparse.valuesBufferView = 1;
+	displacements.sparse = sparse;
+
+	std::vector<fastgltf::math::fvec3> output(vertexCount);
+
+	// This is how copyFromAccessor used to copy sparse accessors, merging the sparse values element by element.
+	BENCHMARK("Copy sparse accessor with iterateAccessorWithIndex") {
+		fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec3>(asset, displacements, [&](fastgltf::math::fvec3 displacement, std::size_t i) {
+			output[i] = displacement;
+		});
+		return output.back();
+	};
+
+	BENCHMARK("Copy sparse accessor with copyFromAccessor") {
+		fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset, displacements, output.data());
+		return output.back();
+	};
+}
+
+TEST_CASE("Compare sparse accessor random access performance", "[gltf-benchmark]") {
+	// A morph target where every fourth vertex is displaced, read in random order like a ray tracer would.
+	constexpr std::size_t vertexCount = 1024 * 1024;
+	constexpr std::size_t sparseCount = vertexCount / 4;
+
+	std::vector<std::uint32_t> indices(sparseCount);
+	std::vector<fastgltf::math::fvec3> values(sparseCount);
+	for (std::size_t i = 0; i < sparseCount; ++i) {
+		indices[i] = static_cast<std::uint32_t>(i * 4);
+		values[i] = fastgltf::math::fvec3(static_cast<float>(i));
+	}
+
+	fastgltf::Asset asset;
+	asset.buffers.emplace_back();
+	asset.buffers.back().byteLength = indices.size() * sizeof(std::uint32_t);
+	asset.buffers.back().data = fastgltf::sources::ByteView { fastgltf::span(reinterpret_cast<const std::byte*>(indices.data()), indices.size() * sizeof(std::uint32_t)) };
+	asset.buffers.emplace_back();
+	asset.buffers.back().byteLength = values.size() * sizeof(fastgltf::math::fvec3);
+	asset.buffers.back().data = fastgltf::sources::ByteView { fastgltf::span(reinterpret_cast<const std::byte*>(values.data()), values.size() * sizeof(fastgltf::math::fvec3)) };
+	for (std::size_t i = 0; i < 2; ++i) {
+		asset.bufferViews.emplace_back();
+		asset.bufferViews.back().bufferIndex = i;
+		asset.bufferViews.back().byteLength = asset.buffers[i].byteLength;
+	}
+
+	auto& displacements = asset.accessors.emplace_back();
+	displacements.count = vertexCount;
+	displacements.type = fastgltf::AccessorType::Vec3;
+	displacements.componentType = fastgltf::ComponentType::Float;
+	fastgltf::SparseAccessor sparse {};
+	sparse.count = sparseCount;
+	sparse.indicesBufferView = 0;
+	sparse.indexComponentType = fastgltf::ComponentType::UnsignedInt;
+	sparse.valuesBufferView = 1;
+	displacements.sparse = sparse;
+
+	std::random_device device;
+	std::mt19937 gen(device());
+	std::uniform_int_distribution<std::size_t> distribution(0, vertexCount - 1);
+	std::vector<std::size_t> queries(1024 * 1024);
+	for (auto& query : queries) {
+		query = distribution(gen);
+	}
+
+	BENCHMARK("Random access with binary search") {
+		fastgltf::math::fvec3 sum;
+		for (auto query : queries) {
+			sum += fastgltf::getAccessorElement<fastgltf::math::fvec3>(asset, displacements, query);
+		}
+		return sum;
+	};
+
+	fastgltf::SparseAccessorLookup lookup(asset, displacements);
+	BENCHMARK("Random access with SparseAccessorLookup") {
+		fastgltf::math::fvec3 sum;
+		for (auto query : queries) {
+			sum += fastgltf::getAccessorElement<fastgltf::math::fvec3>(asset, displacements, query, lookup);
+		}
+		return sum;
+	};
+}
+
+TEST_CASE("Benchmark vertex cache optimization", "[gltf-benchmark]") {
+	// A large grid of quads with the triangles in random order, similar to an unoptimized export.
+	constexpr std::uint32_t gridSize = 512;
+	constexpr auto vertexCount = (gridSize + 1) * (gridSize + 1);
+	std::vector<std::array<std::uint32_t, 3>> triangles;
+	triangles.reserve(gridSize * gridSize * 2);
+	for (std::uint32_t y = 0; y < gridSize; ++y) {
+		for (std::uint32_t x = 0; x < gridSize; ++x) {
+			const auto v = y * (gridSize + 1) + x;
+			triangles.push_back({ v, v + 1, v + gridSize + 1 });
+			triangles.push_back({ v + 1, v + gridSize + 2, v + gridSize + 1 });
+		}
+	}
+	std::random_device device;
+	std::shuffle(triangles.begin(), triangles.end(), std::mt19937(device()));
+
+	std::vector<std::uint32_t> indices(triangles.size() * 3);
+	std::memcpy(indices.data(), triangles.data(), indices.size() * sizeof(std::uint32_t));
+
+	auto optimized = indices;
+	fastgltf::optimizeVertexCache(fastgltf::span<std::uint32_t>(optimized.data(), optimized.size()), vertexCount);
+	const auto before = fastgltf::computeVertexCacheMissRatio(fastgltf::span<const std::uint32_t>(indices.data(), indices.size()), vertexCount);
+	const auto after = fastgltf::computeVertexCacheMissRatio(fastgltf::span<const std::uint32_t>(optimized.data(), optimized.size()), vertexCount);
+	WARN("ACMR before optimization: " << before << ", after optimization: " << after);
+	REQUIRE(after < before);
+
+	BENCHMARK("Optimize vertex cache") {
+		auto copy = indices;
+		fastgltf::optimizeVertexCache(fastgltf::span<std::uint32_t>(copy.data(), copy.size()), vertexCount);
+		return copy;
+	};
+}
+
+TEST_CASE("Compare world transform computation performance", "[gltf-benchmark]") {
+	// A large random hierarchy, where every node has a random translation.
+	constexpr std::size_t nodeCount = 100000;
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+	fastgltf::Asset asset;
+	for (std::size_t i = 0; i < nodeCount; ++i) {
+		auto& node = asset.nodes.emplace_back();
+		fastgltf::TRS trs;
+		trs.translation = fastgltf::math::fvec3(distribution(gen), distribution(gen), distribution(gen));
+		node.transform = trs;
+		if (i >= 16)
+			asset.nodes[std::uniform_int_distribution<std::size_t>(i / 2, i - 1)(gen)].children.emplace_back(i);
+	}
+	auto& scene = asset.scenes.emplace_back();
+	for (std::size_t i = 0; i < 16; ++i)
+		scene.nodeIndices.emplace_back(i);
+
+	std::vector<fastgltf::math::fmat4x4> worldMatrices(nodeCount);
+	BENCHMARK("Compute world transforms with iterateSceneNodes") {
+		fastgltf::iterateSceneNodes(asset, 0, fastgltf::math::fmat4x4(), [&](fastgltf::Node& node, const fastgltf::math::fmat4x4& matrix) {
+			worldMatrices[static_cast<std::size_t>(&node - asset.nodes.data())] = matrix;
+		});
+		return worldMatrices[nodeCount - 1];
+	};
+
+	fastgltf::SceneHierarchy hierarchy(asset, 0);
+	BENCHMARK("Compute world transforms with computeWorldTransforms") {
+		fastgltf::computeWorldTransforms(asset, hierarchy, fastgltf::span<fastgltf::math::fmat4x4>(worldMatrices.data(), worldMatrices.size()));
+		return worldMatrices[nodeCount - 1];
+	};
+
+	// Animations usually only change a small part of the scene every frame.
+	fastgltf::TransformCache cache(asset, 0);
+	std::vector<std::size_t> changedNodes(300);
+	std::vector<fastgltf::math::fvec3> translations(changedNodes.size());
+	for (std::size_t i = 0; i < changedNodes.size(); ++i) {
+		changedNodes[i] = std::uniform_int_distribution<std::size_t>(0, nodeCount - 1)(gen);
+		translations[i] = fastgltf::math::fvec3(distribution(gen), distribution(gen), distribution(gen));
+	}
+	BENCHMARK("Update 300 nodes with TransformCache") {
+		cache.setTranslations(fastgltf::span<const std::size_t>(changedNodes.data(), changedNodes.size()),
+			fastgltf::span<const fastgltf::math::fvec3>(translations.data(), translations.size()));
+		return cache.update();
+	};
+}
+
+TEST_CASE("Compare animation evaluation performance", "[gltf-benchmark]") {
+	// 500 translation channels with 1000 keyframes each, all sharing one input accessor.
+	constexpr std::size_t channelCount = 500;
+	constexpr std::size_t keyCount = 1000;
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+	std::vector<float> data(keyCount + channelCount * keyCount * 3);
+	for (std::size_t i = 0; i < keyCount; ++i)
+		data[i] = static_cast<float>(i) / 30.f;
+	for (std::size_t i = keyCount; i < data.size(); ++i)
+		data[i] = distribution(gen);
+
+	fastgltf::Asset asset;
+	fastgltf::sources::Vector vector;
+	vector.bytes.resize(data.size() * sizeof(float));
+	std::memcpy(vector.bytes.data(), data.data(), vector.bytes.size());
+	auto& buffer = asset.buffers.emplace_back();
+	buffer.byteLength = vector.bytes.size();
+	buffer.data = std::move(vector);
+
+	auto& bufferView = asset.bufferViews.emplace_back();
+	bufferView.bufferIndex = 0;
+	bufferView.byteLength = buffer.byteLength;
+
+	auto& input = asset.accessors.emplace_back();
+	input.count = keyCount;
+	input.type = fastgltf::AccessorType::Scalar;
+	input.componentType = fastgltf::ComponentType::Float;
+	input.bufferViewIndex = 0U;
+
+	auto& animation = asset.animations.emplace_back();
+	for (std::size_t i = 0; i < channelCount; ++i) {
+		auto& output = asset.accessors.emplace_back();
+		output.byteOffset = (keyCount + i * keyCount * 3) * sizeof(float);
+		output.count = keyCount;
+		output.type = fastgltf::AccessorType::Vec3;
+		output.componentType = fastgltf::ComponentType::Float;
+		output.bufferViewIndex = 0U;
+
+		animation.samplers.push_back({ 0, i + 1, fastgltf::AnimationInterpolation::Linear });
+		animation.channels.push_back({ i, i, fastgltf::AnimationPath::Translation });
+		asset.nodes.emplace_back();
+	}
+
+	// Play back 60 frames, which is what a renderer would do every second.
+	std::vector<fastgltf::math::fvec3> translations(channelCount);
+	BENCHMARK("Evaluate 60 frames with getAccessorElement") {
+		for (std::size_t frame = 0; frame < 60; ++frame) {
+			const auto time = static_cast<float>(frame) / 60.f;
+			for (std::size_t i = 0; i < channelCount; ++i) {
+				const auto& sampler = animation.samplers[i];
+				const auto& times = asset.accessors[sampler.inputAccessor];
+				const auto& outputs = asset.accessors[sampler.outputAccessor];
+				std::size_t lower = 0;
+				std::size_t upper = times.count - 1;
+				while (upper - lower > 1) {
+					const auto middle = (lower + upper) / 2;
+					if (fastgltf::getAccessorElement<float>(asset, times, middle) <= time) {
+						lower = middle;
+					} else {
+						upper = middle;
+					}
+				}
+				const auto t0 = fastgltf::getAccessorElement<float>(asset, times, lower);
+				const auto t1 = fastgltf::getAccessorElement<float>(asset, times, upper);
+				translations[i] = fastgltf::math::lerp(fastgltf::getAccessorElement<fastgltf::math::fvec3>(asset, outputs, lower),
+					fastgltf::getAccessorElement<fastgltf::math::fvec3>(asset, outputs, upper), (time - t0) / (t1 - t0));
+			}
+		}
+		return translations[0];
+	};
+
+	fastgltf::AnimationEvaluator evaluator(asset, 0);
+	BENCHMARK("Evaluate 60 frames with AnimationEvaluator") {
+		for (std::size_t frame = 0; frame < 60; ++frame) {
+			evaluator.evaluate(static_cast<float>(frame) / 60.f);
+		}
+		return evaluator.value(0)[0];
+	};
+}
+
+TEST_CASE("Compare joint matrix computation performance", "[gltf-benchmark]") {
+	// 200 skins with 64 joints each, which share the same inverse bind matrices.
+	constexpr std::size_t skinCount = 200;
+	constexpr std::size_t jointCount = 64;
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+	std::vector<float> data(jointCount * 16);
+	for (auto& value : data)
+		value = distribution(gen);
+
+	fastgltf::Asset asset;
+	fastgltf::sources::Vector vector;
+	vector.bytes.resize(data.size() * sizeof(float));
+	std::memcpy(vector.bytes.data(), data.data(), vector.bytes.size());
+	auto& buffer = asset.buffers.emplace_back();
+	buffer.byteLength = vector.bytes.size();
+	buffer.data = std::move(vector);
+
+	auto& bufferView = asset.bufferViews.emplace_back();
+	bufferView.bufferIndex = 0;
+	bufferView.byteLength = buffer.byteLength;
+
+	auto& accessor = asset.accessors.emplace_back();
+	accessor.count = jointCount;
+	accessor.type = fastgltf::AccessorType::Mat4;
+	accessor.componentType = fastgltf::ComponentType::Float;
+	accessor.bufferViewIndex = 0U;
+
+	std::vector<fastgltf::math::fmat4x4> worldMatrices(skinCount * jointCount);
+	for (auto& matrix : worldMatrices) {
+		for (std::size_t i = 0; i < 16; ++i)
+			matrix.data()[i] = distribution(gen);
+	}
+	for (std::size_t i = 0; i < skinCount; ++i) {
+		auto& skin = asset.skins.emplace_back();
+		skin.inverseBindMatrices = 0U;
+		for (std::size_t j = 0; j < jointCount; ++j)
+			skin.joints.emplace_back(std::uniform_int_distribution<std::size_t>(0, worldMatrices.size() - 1)(gen));
+	}
+
+	std::vector<fastgltf::math::fmat4x4> jointMatrices(skinCount * jointCount);
+	BENCHMARK("Compute joint matrices with getAccessorElement") {
+		std::size_t index = 0;
+		for (const auto& skin : asset.skins) {
+			const auto& inverseBindMatrices = asset.accessors[*skin.inverseBindMatrices];
+			for (std::size_t j = 0; j < skin.joints.size(); ++j) {
+				jointMatrices[index++] = worldMatrices[skin.joints[j]]
+					* fastgltf::getAccessorElement<fastgltf::math::fmat4x4>(asset, inverseBindMatrices, j);
+			}
+		}
+		return jointMatrices[0];
+	};
+
+	fastgltf::SkinningCache cache(asset);
+	BENCHMARK("Compute joint matrices with SkinningCache") {
+		cache.computeAllJointMatrices(fastgltf::span<const fastgltf::math::fmat4x4>(worldMatrices.data(), worldMatrices.size()),
+			fastgltf::span<fastgltf::math::fmat4x4>(jointMatrices.data(), jointMatrices.size()));
+		return jointMatrices[0];
+	};
+}
+
+TEST_CASE("Compare morph target blending performance", "[gltf-benchmark]") {
+	// 16 dense position targets of a mesh with 100k vertices, of which half have a non-zero weight.
+	constexpr std::size_t targetCount = 16;
+	constexpr std::size_t vertexCount = 100000;
+	std::mt19937 gen(1234);
+	std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+	std::vector<float> data(targetCount * vertexCount * 3);
+	for (auto& value : data)
+		value = distribution(gen);
+
+	fastgltf::Asset asset;
+	fastgltf::sources::Vector vector;
+	vector.bytes.resize(data.size() * sizeof(float));
+	std::memcpy(vector.bytes.data(), data.data(), vector.bytes.size());
+	auto& buffer = asset.buffers.emplace_back();
+	buffer.byteLength = vector.bytes.size();
+	buffer.data = std::move(vector);
+
+	auto& bufferView = asset.bufferViews.emplace_back();
+	bufferView.bufferIndex = 0;
+	bufferView.byteLength = buffer.byteLength;
+
+	fastgltf::Primitive primitive;
+	std::vector<float> weights(targetCount);
+	for (std::size_t i = 0; i < targetCount; ++i) {
+		auto& accessor = asset.accessors.emplace_back();
+		accessor.byteOffset = i * vertexCount * sizeof(fastgltf::math::fvec3);
+		accessor.count = vertexCount;
+		accessor.type = fastgltf::AccessorType::Vec3;
+		accessor.componentType = fastgltf::ComponentType::Float;
+		accessor.bufferViewIndex = 0U;
+
+		auto& target = primitive.targets.emplace_back();
+		target.emplace_back(fastgltf::Attribute { "POSITION", i });
+		weights[i] = i % 2 == 0 ? distribution(gen) : 0.f;
+	}
+
+	std::vector<fastgltf::math::fvec3> positions(vertexCount);
+	BENCHMARK("Blend morph targets with iterateAccessorWithIndex") {
+		for (std::size_t i = 0; i < targetCount; ++i) {
+			if (weights[i] == 0.f)
+				continue;
+			fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec3>(asset, asset.accessors[i], [&](fastgltf::math::fvec3 position, std::size_t index) {
+				positions[index] += position * weights[i];
+			});
+		}
+		return positions[0];
+	};
+
+	BENCHMARK("Blend morph targets with blendMorphTargets") {
+		fastgltf::blendMorphTargets(asset, primitive, "POSITION", fastgltf::span<const float>(weights.data(), weights.size()),
+			fastgltf::span<fastgltf::math::fvec3>(positions.data(), positions.size()));
+		return positions[0];
+	};
+}
@@ -1,8 +1,15 @@
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <random>
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
 
 #include <fastgltf/core.hpp>
+#include <fastgltf/meshopt.hpp>
+#include <fastgltf/tools.hpp>
 #include "gltf_path.hpp"
 
 // Tests for extension functionality, declared in the same order as the fastgltf::Extensions enum.
@@ -101,6 +108,293 @@ TEST_CASE("Extension EXT_meshopt_compression", "[gltf-loader]") {
 	}
 }
 
+namespace {
+	/**
+	 * A simple vertex codec encoder, which encodes the deltas of every byte group using the smallest
+	 * possible mode, to be able to test the decoders with more data than some handwritten streams.
+	 */
+	std::vector<std::uint8_t> encodeMeshoptVertexBuffer(const std::uint8_t* vertices, std::size_t count, std::size_t byteStride) {
+		std::vector<std::uint8_t> result = { 0xA0 };
+		const auto blockSize = std::min<std::size_t>((8192 / byteStride) & ~std::size_t(15), 256);
+
+		std::vector<std::uint8_t> last(vertices, vertices + byteStride);
+		for (std::size_t offset = 0; offset < count; offset += blockSize) {
+			const auto blockCount = std::min(blockSize, count - offset);
+			const auto alignedCount = (blockCount + 15) & ~std::size_t(15);
+			for (std::size_t k = 0; k < byteStride; ++k) {
+				std::vector<std::uint8_t> deltas(alignedCount, 0);
+				auto previous = last[k];
+				for (std::size_t i = 0; i < blockCount; ++i) {
+					const auto value = vertices[(offset + i) * byteStride + k];
+					const auto delta = static_cast<std::uint8_t>(value - previous);
+					deltas[i] = static_cast<std::uint8_t>((delta << 1) ^ -(delta >> 7));
+					previous = value;
+				}
+
+				const auto headerOffset = result.size();
+				result.resize(result.size() + (alignedCount / 16 + 3) / 4, 0);
+				for (std::size_t group = 0; group < alignedCount / 16; ++group) {
+					const auto* groupDeltas = &deltas[group * 16];
+					const auto max = *std::max_element(groupDeltas, groupDeltas + 16);
+					const auto sentinels = [&](unsigned sentinel) {
+						return static_cast<std::size_t>(std::count_if(groupDeltas, groupDeltas + 16, [&](auto d) { return d >= sentinel; }));
+					};
+
+					unsigned mode = 3;
+					if (max == 0) {
+						mode = 0;
+					} else if (4 + sentinels(3) < 16 && 4 + sentinels(3) <= 8 + sentinels(15)) {
+						mode = 1;
+					} else if (8 + sentinels(15) < 16) {
+						mode = 2;
+					}
+					result[headerOffset + group / 4] |= static_cast<std::uint8_t>(mode << ((group % 4) * 2));
+
+					if (mode == 1 || mode == 2) {
+						const unsigned bits = 1U << mode;
+						const unsigned sentinel = (1U << bits) - 1;
+						std::vector<std::uint8_t> packed(bits * 2, 0);
+						for (std::size_t i = 0; i < 16; ++i) {
+							const auto value = std::min<unsigned>(groupDeltas[i], sentinel);
+							packed[i * bits / 8] |= static_cast<std::uint8_t>(value << (8 - bits - (i * bits) % 8));
+						}
+						result.insert(result.end(), packed.begin(), packed.end());
+						for (std::size_t i = 0; i < 16; ++i) {
+							if (groupDeltas[i] >= sentinel)
+								result.push_back(groupDeltas[i]);
+						}
+					} else if (mode == 3) {
+						result.insert(result.end(), groupDeltas, groupDeltas + 16);
+					}
+				}
+			}
+			std::copy(vertices + (offset + blockCount - 1) * byteStride, vertices + (offset + blockCount) * byteStride, last.begin());
+		}
+
+		// The tail is padded to at least 32 bytes and ends with the first vertex.
+		result.resize(result.size() + std::max<std::size_t>(byteStride, 32) - byteStride, 0);
+		result.insert(result.end(), vertices, vertices + byteStride);
+		return result;
+	}
+} // namespace
+
+TEST_CASE("Test meshopt vertex codec", "[gltf-meshopt]") {
+	// Four vertices of a 12-byte struct of three 16-bit positions, two 8-bit normal components, and two 16-bit UVs.
+	const std::uint8_t encoded[] = {
+		0xA0,
+		0x01, 0x3F, 0x00, 0x00, 0x00, 0x58, 0x57, 0x58, 0x01, 0x26, 0x00, 0x00, 0x00,
+		0x01, 0x0C, 0x00, 0x00, 0x00, 0x58, 0x01, 0x08, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00,
+		0x01, 0x3F, 0x00, 0x00, 0x00, 0x17, 0x18, 0x17, 0x01, 0x26, 0x00, 0x00, 0x00,
+		0x01, 0x0C, 0x00, 0x00, 0x00, 0x17, 0x01, 0x08, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	};
+	const std::uint16_t expected[4][6] = {
+		{ 0, 0, 0, 0, 0, 0 },
+		{ 300, 0, 0, 0, 500, 0 },
+		{ 0, 300, 0, 0, 0, 500 },
+		{ 300, 300, 0, 0, 500, 500 },
+	};
+	const auto source = fastgltf::span(reinterpret_cast<const std::byte*>(encoded), sizeof encoded);
+
+	std::uint16_t decoded[4][6];
+	REQUIRE(fastgltf::meshopt::decodeVertexBuffer(reinterpret_cast<std::byte*>(decoded), 4, sizeof decoded[0], source));
+	REQUIRE(std::memcmp(decoded, expected, sizeof decoded) == 0);
+
+	std::memset(decoded, 0, sizeof decoded);
+	REQUIRE(fastgltf::meshopt::fallback_decode_vertex_buffer(reinterpret_cast<std::byte*>(decoded), 4, sizeof decoded[0], source));
+	REQUIRE(std::memcmp(decoded, expected, sizeof decoded) == 0);
+
+	// Truncated streams and invalid strides have to be rejected.
+	REQUIRE(!fastgltf::meshopt::decodeVertexBuffer(reinterpret_cast<std::byte*>(decoded), 4, sizeof decoded[0], source.first(source.size() - 1)));
+	REQUIRE(!fastgltf::meshopt::decodeVertexBuffer(reinterpret_cast<std::byte*>(decoded), 4, sizeof decoded[0], source.first(40)));
+	REQUIRE(!fastgltf::meshopt::decodeVertexBuffer(reinterpret_cast<std::byte*>(decoded), 4, 6, source));
+
+	// Random data over multiple blocks, with smooth and noisy bytes to use all group modes.
+	std::mt19937 rng(1234);
+	for (std::size_t byteStride : { 4, 16, 48, 256 }) {
+		const std::size_t count = 1003;
+		std::vector<std::uint8_t> vertices(count * byteStride);
+		for (std::size_t i = 0; i < vertices.size(); ++i) {
+			const auto k = i % byteStride;
+			vertices[i] = k % 4 == 0 ? static_cast<std::uint8_t>(rng())
+				: k % 4 == 1 ? static_cast<std::uint8_t>(i / byteStride / 8 + (rng() % 4 == 0))
+				: k % 4 == 2 ? static_cast<std::uint8_t>(i / byteStride + rng() % 8)
+				: std::uint8_t(7);
+		}
+
+		const auto stream = encodeMeshoptVertexBuffer(vertices.data(), count, byteStride);
+		const auto streamSpan = fastgltf::span(reinterpret_cast<const std::byte*>(stream.data()), stream.size());
+
+		std::vector<std::uint8_t> result(vertices.size());
+		REQUIRE(fastgltf::meshopt::fallback_decode_vertex_buffer(reinterpret_cast<std::byte*>(result.data()), count, byteStride, streamSpan));
+		REQUIRE(result == vertices);
+
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_IX86)
+		std::fill(result.begin(), result.end(), std::uint8_t(0));
+		REQUIRE(fastgltf::meshopt::sse4_decode_vertex_buffer(reinterpret_cast<std::byte*>(result.data()), count, byteStride, streamSpan));
+		REQUIRE(result == vertices);
+#endif
+	}
+}
+
+TEST_CASE("Test meshopt index codecs", "[gltf-meshopt]") {
+	// The triangle list 0 1 2, 2 1 3, 4 6 5, 7 8 9, encoded with version 0 of the index codec.
+	const std::uint8_t triangles[] = {
+		0xE0, 0xF0, 0x10, 0xFE, 0xFF, 0xF0, 0x0C, 0xFF, 0x02, 0x02, 0x02, 0x00, 0x76, 0x87, 0x56, 0x67,
+		0x78, 0xA9, 0x86, 0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0x00, 0x00,
+	};
+	const auto triangleSource = fastgltf::span(reinterpret_cast<const std::byte*>(triangles), sizeof triangles);
+
+	std::uint32_t indices[12];
+	REQUIRE(fastgltf::meshopt::decodeIndexBuffer(reinterpret_cast<std::byte*>(indices), 12, sizeof(std::uint32_t), triangleSource));
+	const std::uint32_t expectedTriangles[] = { 0, 1, 2, 2, 1, 3, 4, 6, 5, 7, 8, 9 };
+	REQUIRE(std::memcmp(indices, expectedTriangles, sizeof indices) == 0);
+
+	std::uint16_t shortIndices[12];
+	REQUIRE(fastgltf::meshopt::decodeIndexBuffer(reinterpret_cast<std::byte*>(shortIndices), 12, sizeof(std::uint16_t), triangleSource));
+	for (std::size_t i = 0; i < 12; ++i) {
+		REQUIRE(shortIndices[i] == expectedTriangles[i]);
+	}
+
+	REQUIRE(!fastgltf::meshopt::decodeIndexBuffer(reinterpret_cast<std::byte*>(indices), 12, sizeof(std::uint32_t), triangleSource.first(triangleSource.size() - 1)));
+	REQUIRE(!fastgltf::meshopt::decodeIndexBuffer(reinterpret_cast<std::byte*>(indices), 9, sizeof(std::uint32_t), triangleSource));
+
+	// The index sequence 0 1 51 2 49 1000, which uses both baselines and a multi-byte varint.
+	const std::uint8_t sequence[] = { 0xD1, 0x00, 0x04, 0xCD, 0x01, 0x04, 0x07, 0x98, 0x1F, 0x00, 0x00, 0x00, 0x00 };
+	const auto sequenceSource = fastgltf::span(reinterpret_cast<const std::byte*>(sequence), sizeof sequence);
+
+	REQUIRE(fastgltf::meshopt::decodeIndexSequence(reinterpret_cast<std::byte*>(indices), 6, sizeof(std::uint32_t), sequenceSource));
+	const std::uint32_t expectedSequence[] = { 0, 1, 51, 2, 49, 1000 };
+	REQUIRE(std::memcmp(indices, expectedSequence, sizeof expectedSequence) == 0);
+
+	REQUIRE(!fastgltf::meshopt::decodeIndexSequence(reinterpret_cast<std::byte*>(indices), 5, sizeof(std::uint32_t), sequenceSource));
+	REQUIRE(!fastgltf::meshopt::decodeIndexSequence(reinterpret_cast<std::byte*>(indices), 6, 3, sequenceSource));
+}
+
+TEST_CASE("Test meshopt filters", "[gltf-meshopt]") {
+	using fastgltf::MeshoptCompressionFilter;
+
+	// A mantissa of 3 and an exponent of -1.
+	std::uint32_t exponential[] = { 0xFF000003 };
+	REQUIRE(fastgltf::meshopt::decodeFilter(MeshoptCompressionFilter::Exponential, reinterpret_cast<std::byte*>(exponential), 1, 4));
+	float value;
+	std::memcpy(&value, exponential, sizeof value);
+	REQUIRE(value == 1.5f);
+
+	// A normal pointing towards +Z, and one pointing towards -Z, which is stored in the corners of the octahedron.
+	// The third component always stores 1.0 as the encoder picks the quantization based on it.
+	std::int8_t octahedral[] = { 0, 0, 127, 42, 127, 127, 127, 0 };
+	REQUIRE(fastgltf::meshopt::decodeFilter(MeshoptCompressionFilter::Octahedral, reinterpret_cast<std::byte*>(octahedral), 2, 4));
+	const std::int8_t expectedOctahedral[] = { 0, 0, 127, 42, 0, 0, -127, 0 };
+	REQUIRE(std::memcmp(octahedral, expectedOctahedral, sizeof octahedral) == 0);
+
+	// The identity quaternion, with w being the largest component.
+	std::int16_t quaternion[] = { 0, 0, 0, static_cast<std::int16_t>(0x7FFC | 3) };
+	REQUIRE(fastgltf::meshopt::decodeFilter(MeshoptCompressionFilter::Quaternion, reinterpret_cast<std::byte*>(quaternion), 1, 8));
+	const std::int16_t expectedQuaternion[] = { 0, 0, 0, 32767 };
+	REQUIRE(std::memcmp(quaternion, expectedQuaternion, sizeof quaternion) == 0);
+
+	REQUIRE(!fastgltf::meshopt::decodeFilter(MeshoptCompressionFilter::Quaternion, reinterpret_cast<std::byte*>(quaternion), 1, 4));
+	REQUIRE(!fastgltf::meshopt::decodeFilter(MeshoptCompressionFilter::Octahedral, reinterpret_cast<std::byte*>(octahedral), 1, 12));
+
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_IX86)
+	// The SIMD filters have to produce exactly the same results as the scalar filters.
+	std::mt19937 rng(4321);
+	const std::size_t count = 4099;
+	std::vector<std::uint8_t> input(count * 8);
+	for (auto& byte : input)
+		byte = static_cast<std::uint8_t>(rng());
+
+	const std::pair<MeshoptCompressionFilter, std::size_t> filters[] = {
+		{ MeshoptCompressionFilter::Octahedral, 4 },
+		{ MeshoptCompressionFilter::Octahedral, 8 },
+		{ MeshoptCompressionFilter::Quaternion, 8 },
+		{ MeshoptCompressionFilter::Exponential, 8 },
+	};
+	for (auto [filter, byteStride] : filters) {
+		auto expected = input;
+		fastgltf::meshopt::fallback_decode_filter(filter, reinterpret_cast<std::byte*>(expected.data()), count, byteStride);
+		auto result = input;
+		fastgltf::meshopt::sse4_decode_filter(filter, reinterpret_cast<std::byte*>(result.data()), count, byteStride);
+		REQUIRE(std::memcmp(result.data(), expected.data(), count * byteStride) == 0);
+	}
+#endif
+}
+
+TEST_CASE("Test EXT_meshopt_compression decompression", "[gltf-meshopt]") {
+	auto brainStem = sampleModels / "2.0" / "BrainStem" / "glTF-Meshopt";
+	fastgltf::GltfFileStream jsonData(brainStem / "BrainStem.gltf");
+	REQUIRE(jsonData.isOpen());
+
+	fastgltf::Parser parser(fastgltf::Extensions::EXT_meshopt_compression | fastgltf::Extensions::KHR_mesh_quantization);
+	auto asset = parser.loadGltfJson(jsonData, brainStem,
+		fastgltf::Options::LoadExternalBuffers | fastgltf::Options::DecompressMeshoptBuffers);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+	REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+
+	for (auto& bufferView : asset->bufferViews) {
+		REQUIRE(!bufferView.meshoptCompression);
+		REQUIRE(std::holds_alternative<fastgltf::sources::Array>(asset->buffers[bufferView.bufferIndex].data));
+	}
+
+	// Every index has to be in the range of the vertex attributes.
+	for (auto& mesh : asset->meshes) {
+		for (auto& primitive : mesh.primitives) {
+			REQUIRE(primitive.indicesAccessor.has_value());
+			auto& positions = asset->accessors[primitive.findAttribute("POSITION")->accessorIndex];
+			fastgltf::iterateAccessor<std::uint32_t>(asset.get(), asset->accessors[*primitive.indicesAccessor], [&](std::uint32_t index) {
+				REQUIRE(index < positions.count);
+			});
+		}
+	}
+}
+
+TEST_CASE("Test meshopt decompression validation", "[gltf-meshopt]") {
+	// The index sequence 0 1 51 2 49 1000, compressed with the INDICES mode.
+	const std::uint8_t sequence[] = { 0xD1, 0x00, 0x04, 0xCD, 0x01, 0x04, 0x07, 0x98, 0x1F, 0x00, 0x00, 0x00, 0x00 };
+	auto createAsset = [&](std::size_t count, std::size_t byteStride, std::size_t byteLength) {
+		fastgltf::Asset asset;
+		auto& buffer = asset.buffers.emplace_back();
+		buffer.byteLength = sizeof sequence;
+		buffer.data = fastgltf::sources::ByteView { fastgltf::span(reinterpret_cast<const std::byte*>(sequence), sizeof sequence) };
+
+		auto& bufferView = asset.bufferViews.emplace_back();
+		bufferView.bufferIndex = 0;
+		bufferView.byteLength = byteLength;
+		bufferView.meshoptCompression = std::make_unique<fastgltf::CompressedBufferView>();
+		bufferView.meshoptCompression->bufferIndex = 0;
+		bufferView.meshoptCompression->byteOffset = 0;
+		bufferView.meshoptCompression->byteLength = sizeof sequence;
+		bufferView.meshoptCompression->count = count;
+		bufferView.meshoptCompression->byteStride = byteStride;
+		bufferView.meshoptCompression->mode = fastgltf::MeshoptCompressionMode::Indices;
+		bufferView.meshoptCompression->filter = fastgltf::MeshoptCompressionFilter::None;
+		return asset;
+	};
+
+	auto valid = createAsset(6, sizeof(std::uint32_t), 6 * sizeof(std::uint32_t));
+	REQUIRE(fastgltf::decompressMeshoptBufferView(valid, 0) == fastgltf::Error::None);
+	REQUIRE(valid.buffers.size() == 2);
+	auto* decompressed = std::get_if<fastgltf::sources::Array>(&valid.buffers[1].data);
+	REQUIRE(decompressed != nullptr);
+	const std::uint32_t expectedIndices[] = { 0, 1, 51, 2, 49, 1000 };
+	REQUIRE(decompressed->bytes.size_bytes() == sizeof expectedIndices);
+	REQUIRE(std::memcmp(decompressed->bytes.data(), expectedIndices, sizeof expectedIndices) == 0);
+
+	// These have to be rejected before anything is allocated for the decompressed data.
+	auto zeroStride = createAsset(6, 0, 0);
+	REQUIRE(fastgltf::decompressMeshoptBufferView(zeroStride, 0) == fastgltf::Error::InvalidGltf);
+	auto invalidStride = createAsset(6, 3, 18);
+	REQUIRE(fastgltf::decompressMeshoptBufferView(invalidStride, 0) == fastgltf::Error::InvalidGltf);
+	auto overflow = createAsset(std::numeric_limits<std::size_t>::max() / 2 + 1, sizeof(std::uint32_t), 0);
+	REQUIRE(fastgltf::decompressMeshoptBufferView(overflow, 0) == fastgltf::Error::InvalidGltf);
+	auto lengthMismatch = createAsset(6, sizeof(std::uint32_t), 1024 * 1024);
+	REQUIRE(fastgltf::decompressMeshoptBufferView(lengthMismatch, 0) == fastgltf::Error::InvalidGltf);
+	REQUIRE(lengthMismatch.buffers.size() == 1);
+}
+
 TEST_CASE("Extension KHR_draco_mesh_compression", "[gltf-loader]") {
 	auto brainStem = sampleModels / "2.0" / "BrainStem" / "glTF-Draco";
 	fastgltf::GltfFileStream jsonData(brainStem / "BrainStem.gltf");
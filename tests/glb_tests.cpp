@@ -1,3 +1,4 @@
+#include <cstring>
 #include <fstream>
 
 #include <catch2/catch_test_macros.hpp>
@@ -54,3 +55,67 @@ TEST_CASE("Load basic GLB file", "[gltf-loader]") {
         REQUIRE(asset.error() == fastgltf::Error::None);
     }
 }
+
+TEST_CASE("Load GLB without reading the BIN chunk", "[gltf-loader]") {
+	auto folder = sampleModels / "2.0" / "Box" / "glTF-Binary";
+	fastgltf::Parser parser;
+
+	auto copiedData = fastgltf::GltfDataBuffer::FromPath(folder / "Box.glb");
+	REQUIRE(copiedData.error() == fastgltf::Error::None);
+	auto copiedAsset = parser.loadGltfBinary(copiedData.get(), folder);
+	REQUIRE(copiedAsset.error() == fastgltf::Error::None);
+	auto* array = std::get_if<fastgltf::sources::Array>(&copiedAsset->buffers.front().data);
+	REQUIRE(array != nullptr);
+
+	fastgltf::GltfFileStream fileStream(folder / "Box.glb");
+	REQUIRE(fileStream.isOpen());
+	auto asset = parser.loadGltfBinary(fileStream, folder, fastgltf::Options::DeferGLBBuffer);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+	REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+	REQUIRE(fileStream.bytesRead() == fileStream.totalSize());
+	REQUIRE(asset->meshes.size() == copiedAsset->meshes.size());
+
+	REQUIRE(asset->buffers.size() == 1);
+	auto* filePath = std::get_if<fastgltf::sources::URI>(&asset->buffers.front().data);
+	REQUIRE(filePath != nullptr);
+	REQUIRE(filePath->uri.path().empty());
+	REQUIRE(filePath->mimeType == fastgltf::MimeType::GltfBuffer);
+
+	// The recorded offset has to point at the same bytes that would have been loaded.
+	std::ifstream file(folder / "Box.glb", std::ios::binary);
+	file.seekg(static_cast<std::streamoff>(filePath->fileByteOffset));
+	std::vector<std::byte> bytes(array->bytes.size());
+	file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+	REQUIRE(std::memcmp(bytes.data(), array->bytes.data(), bytes.size()) == 0);
+}
+
+#if defined(FASTGLTF_HAS_MEMORY_MAPPED_FILE)
+TEST_CASE("Load GLB buffer from mapped file without copying", "[gltf-loader]") {
+	auto folder = sampleModels / "2.0" / "Box" / "glTF-Binary";
+	fastgltf::Parser parser;
+
+	auto copiedData = fastgltf::GltfDataBuffer::FromPath(folder / "Box.glb");
+	REQUIRE(copiedData.error() == fastgltf::Error::None);
+	auto copiedAsset = parser.loadGltfBinary(copiedData.get(), folder, fastgltf::Options::MapGLBBuffer, fastgltf::Category::Buffers);
+	REQUIRE(copiedAsset.error() == fastgltf::Error::None);
+	auto* array = std::get_if<fastgltf::sources::Array>(&copiedAsset->buffers.front().data);
+	REQUIRE(array != nullptr);
+
+	fastgltf::Expected<fastgltf::Asset> asset = fastgltf::Error::None;
+	{
+		auto mappedFile = fastgltf::MappedGltfFile::FromPath(folder / "Box.glb");
+		REQUIRE(mappedFile.error() == fastgltf::Error::None);
+
+		asset = parser.loadGltfBinary(mappedFile.get(), folder, fastgltf::Options::MapGLBBuffer, fastgltf::Category::Buffers);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+	}
+
+	// The mapping has to stay alive after the MappedGltfFile has been destroyed.
+	REQUIRE(asset->buffers.size() == 1);
+	auto* byteView = std::get_if<fastgltf::sources::ByteView>(&asset->buffers.front().data);
+	REQUIRE(byteView != nullptr);
+	REQUIRE(byteView->mimeType == fastgltf::MimeType::GltfBuffer);
+	REQUIRE(byteView->bytes.size() == array->bytes.size());
+	REQUIRE(std::memcmp(byteView->bytes.data(), array->bytes.data(), array->bytes.size()) == 0);
+}
+#endif
@@ -1,7 +1,9 @@
+#include <cstring>
 #include <random>
 
 #include <fastgltf/math.hpp>
 #include <fastgltf/core.hpp>
+#include <fastgltf/tools.hpp>
 #include "gltf_path.hpp"
 
 #include <glm/glm.hpp>
@@ -294,3 +296,385 @@ TEST_CASE("Test TRS parsing and optional decomposition", "[maths]") {
 		REQUIRE(glm::all(glm::epsilonEqual(glm::make_vec3(scale.data()), glmScale, glm::epsilon<float>())));
 	}
 }
+
+/** Returns a random rotation, translation, and scale, where the scale is close to one. */
+fastgltf::TRS randomTRS(std::mt19937& gen) {
+	std::uniform_real_distribution<float> distribution(-2.f, 2.f);
+	std::uniform_real_distribution<float> scaleDistribution(0.8f, 1.2f);
+	fastgltf::TRS trs;
+	trs.translation = fastgltf::math::fvec3(distribution(gen), distribution(gen), distribution(gen));
+	trs.rotation = fastgltf::math::fquat(distribution(gen), distribution(gen), distribution(gen), distribution(gen));
+	const auto length = std::sqrt(fastgltf::math::dot(trs.rotation, trs.rotation));
+	for (std::size_t i = 0; i < 4; ++i)
+		trs.rotation[i] /= length;
+	trs.scale = fastgltf::math::fvec3(scaleDistribution(gen), scaleDistribution(gen), scaleDistribution(gen));
+	return trs;
+}
+
+/** Creates a random hierarchy of nodes with four root nodes, using both TRS and matrix transforms. */
+fastgltf::Asset createRandomHierarchy(std::mt19937& gen, std::size_t nodeCount) {
+	fastgltf::Asset asset;
+	for (std::size_t i = 0; i < nodeCount; ++i) {
+		auto& node = asset.nodes.emplace_back();
+		auto trs = randomTRS(gen);
+		if (i % 3 == 0) {
+			node.transform = fastgltf::math::composeTransformMatrix(trs.translation, trs.rotation, trs.scale);
+		} else {
+			node.transform = trs;
+		}
+		if (i < 4) {
+			continue;
+		}
+		// Every node after the first few is the child of a random previous node, which gives a deep hierarchy.
+		std::uniform_int_distribution<std::size_t> parentDistribution(i / 2, i - 1);
+		asset.nodes[parentDistribution(gen)].children.emplace_back(i);
+	}
+	auto& scene = asset.scenes.emplace_back();
+	for (std::size_t i = 0; i < 4; ++i)
+		scene.nodeIndices.emplace_back(i);
+	return asset;
+}
+
+/** Checks that the matrices are equal up to a small relative error. */
+void requireMatricesEqual(const fastgltf::math::fmat4x4& a, const fastgltf::math::fmat4x4& b) {
+	for (std::size_t j = 0; j < 16; ++j) {
+		REQUIRE(std::abs(a.data()[j] - b.data()[j]) <= 1e-5f * std::max(1.f, std::abs(b.data()[j])));
+	}
+}
+
+TEST_CASE("Test world transform computation", "[maths]") {
+	constexpr std::size_t nodeCount = 1000;
+	std::mt19937 gen(4321);
+	auto asset = createRandomHierarchy(gen, nodeCount);
+
+	const fastgltf::math::fmat4x4 initial = fastgltf::math::scale(fastgltf::math::fmat4x4(), fastgltf::math::fvec3(2.f));
+	std::vector<fastgltf::math::fmat4x4> expected(nodeCount);
+	fastgltf::iterateSceneNodes(asset, 0, initial, [&](fastgltf::Node& node, const fastgltf::math::fmat4x4& matrix) {
+		expected[static_cast<std::size_t>(&node - asset.nodes.data())] = matrix;
+	});
+
+	fastgltf::SceneHierarchy hierarchy(asset, 0);
+	REQUIRE(hierarchy.size() == nodeCount);
+	std::vector<std::size_t> positions(nodeCount);
+	for (std::size_t i = 0; i < hierarchy.size(); ++i)
+		positions[hierarchy.nodes()[i]] = i;
+	for (std::size_t i = 0; i < hierarchy.size(); ++i) {
+		const auto parent = hierarchy.parents()[i];
+		REQUIRE((parent == fastgltf::SceneHierarchy::noParent || positions[parent] < i));
+	}
+
+	auto requireExpectedMatrices = [&](const std::vector<fastgltf::math::fmat4x4>& matrices) {
+		for (std::size_t i = 0; i < nodeCount; ++i) {
+			requireMatricesEqual(matrices[i], expected[i]);
+		}
+	};
+
+	std::vector<fastgltf::math::fmat4x4> worldMatrices(nodeCount);
+	fastgltf::computeWorldTransforms(asset, hierarchy, fastgltf::span<fastgltf::math::fmat4x4>(worldMatrices.data(), worldMatrices.size()), initial);
+	requireExpectedMatrices(worldMatrices);
+
+	std::vector<fastgltf::math::fmat4x4> fallbackMatrices(nodeCount);
+	fastgltf::internal::fallback_compute_world_transforms(asset.nodes.data(), hierarchy.nodes().data(), hierarchy.parents().data(),
+		hierarchy.size(), initial, fallbackMatrices.data());
+	requireExpectedMatrices(fallbackMatrices);
+
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_IX86)
+	std::vector<fastgltf::math::fmat4x4> sseMatrices(nodeCount);
+	fastgltf::internal::sse4_compute_world_transforms(asset.nodes.data(), hierarchy.nodes().data(), hierarchy.parents().data(),
+		hierarchy.size(), initial, sseMatrices.data());
+	requireExpectedMatrices(sseMatrices);
+#endif
+
+	// A cycle in the hierarchy is only traversed once.
+	asset.nodes.back().children.emplace_back(0);
+	REQUIRE(fastgltf::SceneHierarchy(asset, 0).size() == nodeCount);
+}
+
+TEST_CASE("Test transform cache", "[maths]") {
+	constexpr std::size_t nodeCount = 1000;
+	std::mt19937 gen(1234);
+	auto asset = createRandomHierarchy(gen, nodeCount);
+	// An additional node which is not part of the scene.
+	asset.nodes.emplace_back();
+
+	const fastgltf::math::fmat4x4 initial = fastgltf::math::translate(fastgltf::math::fmat4x4(), fastgltf::math::fvec3(1.f, 2.f, 3.f));
+	fastgltf::TransformCache cache(asset, 0, initial);
+	fastgltf::SceneHierarchy hierarchy(asset, 0);
+	std::vector<fastgltf::math::fmat4x4> expected(asset.nodes.size());
+	auto requireExpectedMatrices = [&]() {
+		fastgltf::computeWorldTransforms(asset, hierarchy, fastgltf::span<fastgltf::math::fmat4x4>(expected.data(), expected.size()), initial);
+		for (std::size_t i = 0; i < asset.nodes.size(); ++i) {
+			requireMatricesEqual(cache.world(i), expected[i]);
+		}
+	};
+	requireExpectedMatrices();
+	REQUIRE(cache.update() == 0);
+
+	// Change a few nodes, and count how many nodes are part of the changed subtrees.
+	std::vector<std::size_t> changedNodes = { 17, 420, 421, 999 };
+	std::vector<fastgltf::math::fquat> rotations;
+	for (auto nodeIndex : changedNodes) {
+		auto trs = randomTRS(gen);
+		rotations.emplace_back(trs.rotation);
+		trs.translation = cache.translations()[nodeIndex];
+		trs.scale = cache.scales()[nodeIndex];
+		asset.nodes[nodeIndex].transform = trs;
+	}
+	cache.setRotations(fastgltf::span<const std::size_t>(changedNodes.data(), changedNodes.size()),
+		fastgltf::span<const fastgltf::math::fquat>(rotations.data(), rotations.size()));
+
+	auto trs = randomTRS(gen);
+	asset.nodes[2].transform = trs;
+	cache.setTRS(2, trs);
+	changedNodes.emplace_back(2);
+
+	std::vector<std::size_t> parents(asset.nodes.size(), fastgltf::SceneHierarchy::noParent);
+	for (std::size_t i = 0; i < hierarchy.size(); ++i)
+		parents[hierarchy.nodes()[i]] = hierarchy.parents()[i];
+	auto countAffectedNodes = [&](const std::vector<std::size_t>& changed) {
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < hierarchy.size(); ++i) {
+			for (auto node = hierarchy.nodes()[i]; node != fastgltf::SceneHierarchy::noParent; node = parents[node]) {
+				if (std::find(changed.begin(), changed.end(), node) != changed.end()) {
+					++count;
+					break;
+				}
+			}
+		}
+		return count;
+	};
+	for (auto nodeIndex : changedNodes)
+		REQUIRE(cache.isDirty(nodeIndex));
+
+	REQUIRE(cache.update() == countAffectedNodes(changedNodes));
+	REQUIRE(!cache.isDirty(2));
+	requireExpectedMatrices();
+
+	// Changing a node outside of the scene does not recompute anything.
+	cache.setTranslation(nodeCount, fastgltf::math::fvec3(1.f));
+	REQUIRE(cache.update() == 0);
+	REQUIRE(cache.world(nodeCount) == fastgltf::math::fmat4x4());
+
+	// A root node recomputes its entire subtree.
+	asset.nodes[3].transform = fastgltf::math::fmat4x4(2.f);
+	cache.setMatrix(3, fastgltf::math::fmat4x4(2.f));
+	REQUIRE(cache.update() == countAffectedNodes({ 3 }));
+	requireExpectedMatrices();
+}
+
+/** Adds an accessor with the given float data, which is stored in its own buffer. */
+std::size_t addFloatAccessor(fastgltf::Asset& asset, const std::vector<float>& data, fastgltf::AccessorType type) {
+	fastgltf::sources::Vector vector;
+	vector.bytes.resize(data.size() * sizeof(float));
+	std::memcpy(vector.bytes.data(), data.data(), vector.bytes.size());
+
+	auto& buffer = asset.buffers.emplace_back();
+	buffer.byteLength = vector.bytes.size();
+	buffer.data = std::move(vector);
+
+	auto& bufferView = asset.bufferViews.emplace_back();
+	bufferView.bufferIndex = asset.buffers.size() - 1;
+	bufferView.byteLength = buffer.byteLength;
+
+	auto& accessor = asset.accessors.emplace_back();
+	accessor.count = data.size() / fastgltf::getNumComponents(type);
+	accessor.type = type;
+	accessor.componentType = fastgltf::ComponentType::Float;
+	accessor.bufferViewIndex = asset.bufferViews.size() - 1;
+	return asset.accessors.size() - 1;
+}
+
+TEST_CASE("Test animation evaluation", "[maths]") {
+	fastgltf::Asset asset;
+	asset.nodes.resize(3);
+	asset.nodes[0].transform = fastgltf::TRS {};
+	asset.nodes[1].transform = fastgltf::math::translate(fastgltf::math::fmat4x4(), fastgltf::math::fvec3(1.f, 2.f, 3.f));
+	asset.nodes[2].transform = fastgltf::TRS {};
+	auto& scene = asset.scenes.emplace_back();
+	for (std::size_t i = 0; i < asset.nodes.size(); ++i)
+		scene.nodeIndices.emplace_back(i);
+
+	const float halfSqrt2 = std::sqrt(0.5f);
+	const std::vector<glm::quat> rotations = {
+		glm::quat(1.f, 0.f, 0.f, 0.f), glm::quat(halfSqrt2, 0.f, 0.f, halfSqrt2),
+		glm::quat(0.f, 0.f, 0.f, 1.f), glm::quat(0.f, 0.f, 0.f, -1.f),
+	};
+	std::vector<float> rotationData;
+	for (const auto& rotation : rotations) {
+		rotationData.insert(rotationData.end(), { rotation.x, rotation.y, rotation.z, rotation.w });
+	}
+
+	const auto times = addFloatAccessor(asset, { 0.f, 1.f, 2.f, 4.f }, fastgltf::AccessorType::Scalar);
+	const auto translations = addFloatAccessor(asset, { 0.f, 0.f, 0.f, 1.f, 2.f, 3.f, 3.f, 2.f, 1.f, 5.f, 5.f, 5.f }, fastgltf::AccessorType::Vec3);
+	const auto rotationAccessor = addFloatAccessor(asset, rotationData, fastgltf::AccessorType::Vec4);
+	const auto scales = addFloatAccessor(asset, { 1.f, 1.f, 1.f, 2.f, 2.f, 2.f, 3.f, 3.f, 3.f, 4.f, 4.f, 4.f }, fastgltf::AccessorType::Vec3);
+	// Two morph target weights per keyframe, with an in-tangent, the value, and an out-tangent each.
+	// The tangents of the first weight make the spline a straight line, and the second one is a parabola.
+	const auto weights = addFloatAccessor(asset, {
+		1.f, -1.f, 0.f, 0.f, 1.f, 1.f,
+		1.f, -1.f, 1.f, 0.f, 1.f, 1.f,
+		0.f, 0.f, 1.f, 0.f, 0.f, 0.f,
+		0.f, 0.f, 1.f, 0.f, 0.f, 0.f,
+	}, fastgltf::AccessorType::Scalar);
+
+	auto& animation = asset.animations.emplace_back();
+	animation.samplers.push_back({ times, translations, fastgltf::AnimationInterpolation::Linear });
+	animation.samplers.push_back({ times, rotationAccessor, fastgltf::AnimationInterpolation::Linear });
+	animation.samplers.push_back({ times, scales, fastgltf::AnimationInterpolation::Step });
+	animation.samplers.push_back({ times, weights, fastgltf::AnimationInterpolation::CubicSpline });
+	animation.channels.push_back({ 0, 0U, fastgltf::AnimationPath::Translation });
+	animation.channels.push_back({ 1, 0U, fastgltf::AnimationPath::Rotation });
+	animation.channels.push_back({ 2, 1U, fastgltf::AnimationPath::Scale });
+	animation.channels.push_back({ 3, 2U, fastgltf::AnimationPath::Weights });
+	// Channels with a sampler not matching the path, or without a node, are ignored.
+	animation.channels.push_back({ 0, 2U, fastgltf::AnimationPath::Rotation });
+	animation.channels.push_back({ 0, {}, fastgltf::AnimationPath::Translation });
+
+	fastgltf::AnimationEvaluator evaluator(asset, 0);
+	REQUIRE(evaluator.size() == 4);
+	REQUIRE(evaluator.minTime() == 0.f);
+	REQUIRE(evaluator.maxTime() == 4.f);
+	REQUIRE(evaluator.nodeIndex(3) == 2);
+	REQUIRE(evaluator.path(3) == fastgltf::AnimationPath::Weights);
+	REQUIRE(evaluator.value(3).size() == 2);
+
+	auto requireValue = [&](std::size_t channel, std::initializer_list<float> expected) {
+		auto value = evaluator.value(channel);
+		REQUIRE(value.size() == expected.size());
+		for (std::size_t i = 0; i < value.size(); ++i) {
+			REQUIRE(std::abs(value[i] - expected.begin()[i]) < 1e-5f);
+		}
+	};
+	auto requireRotation = [&](float time) {
+		const auto segment = time < 1.f ? 0 : (time < 2.f ? 1 : 2);
+		const float starts[] = { 0.f, 1.f, 2.f };
+		const float lengths[] = { 1.f, 1.f, 2.f };
+		auto expected = glm::slerp(rotations[segment], rotations[segment + 1], (time - starts[segment]) / lengths[segment]);
+		// q and -q describe the same rotation.
+		auto value = evaluator.value(1);
+		const float sign = value[0] * expected.x + value[1] * expected.y + value[2] * expected.z + value[3] * expected.w < 0.f ? -1.f : 1.f;
+		requireValue(1, { sign * expected.x, sign * expected.y, sign * expected.z, sign * expected.w });
+	};
+
+	requireValue(0, { 0.f, 0.f, 0.f });
+	evaluator.evaluate(0.5f);
+	requireValue(0, { 0.5f, 1.f, 1.5f });
+	requireValue(2, { 1.f, 1.f, 1.f });
+	requireValue(3, { 0.5f, 0.25f });
+	requireRotation(0.5f);
+	evaluator.evaluate(1.5f);
+	requireRotation(1.5f);
+	evaluator.evaluate(3.f);
+	requireValue(0, { 4.f, 3.5f, 3.f });
+	requireValue(2, { 3.f, 3.f, 3.f });
+	requireValue(3, { 1.f, 0.f });
+	requireRotation(3.f);
+
+	// Times outside of the keyframes are clamped.
+	evaluator.evaluate(10.f);
+	requireValue(0, { 5.f, 5.f, 5.f });
+	requireValue(2, { 4.f, 4.f, 4.f });
+	evaluator.evaluate(-1.f);
+	requireValue(0, { 0.f, 0.f, 0.f });
+	requireValue(3, { 0.f, 0.f });
+
+	// Playing forwards, and seeking backwards, gives the same result as a new evaluator.
+	auto requireSameAsNew = [&](float time) {
+		evaluator.evaluate(time);
+		fastgltf::AnimationEvaluator expected(asset, 0);
+		expected.evaluate(time);
+		for (std::size_t i = 0; i < evaluator.size(); ++i) {
+			for (std::size_t j = 0; j < evaluator.value(i).size(); ++j)
+				REQUIRE(evaluator.value(i)[j] == expected.value(i)[j]);
+		}
+	};
+	for (float time = 0.f; time < 4.2f; time += 0.05f)
+		requireSameAsNew(time);
+	for (float time : { 3.5f, 0.2f, 2.f, 1.f, 0.f, 3.9f })
+		requireSameAsNew(time);
+
+	// Applying the values converts node 1 into TRS, and keeps its translation.
+	evaluator.evaluate(3.f);
+	fastgltf::TransformCache cache(asset, 0);
+	evaluator.apply(cache);
+	evaluator.apply(asset);
+	auto& trs = std::get<fastgltf::TRS>(asset.nodes[0].transform);
+	REQUIRE(trs.translation == fastgltf::math::fvec3(4.f, 3.5f, 3.f));
+	auto* matrixTrs = std::get_if<fastgltf::TRS>(&asset.nodes[1].transform);
+	REQUIRE(matrixTrs != nullptr);
+	REQUIRE(matrixTrs->translation == fastgltf::math::fvec3(1.f, 2.f, 3.f));
+	REQUIRE(matrixTrs->scale == fastgltf::math::fvec3(3.f));
+	REQUIRE(asset.nodes[2].weights.size() == 2);
+	REQUIRE(std::abs(asset.nodes[2].weights[0] - 1.f) < 1e-5f);
+
+	REQUIRE(cache.update() == 2);
+	fastgltf::SceneHierarchy hierarchy(asset, 0);
+	std::vector<fastgltf::math::fmat4x4> expected(asset.nodes.size());
+	fastgltf::computeWorldTransforms(asset, hierarchy, fastgltf::span<fastgltf::math::fmat4x4>(expected.data(), expected.size()));
+	for (std::size_t i = 0; i < asset.nodes.size(); ++i) {
+		requireMatricesEqual(cache.world(i), expected[i]);
+	}
+}
+
+TEST_CASE("Test skinning joint matrices", "[maths]") {
+	constexpr std::size_t nodeCount = 200;
+	std::mt19937 gen(5678);
+	auto asset = createRandomHierarchy(gen, nodeCount);
+
+	std::vector<fastgltf::math::fmat4x4> worldMatrices(nodeCount);
+	fastgltf::computeWorldTransforms(asset, fastgltf::SceneHierarchy(asset, 0),
+		fastgltf::span<fastgltf::math::fmat4x4>(worldMatrices.data(), worldMatrices.size()));
+
+	// The first skin has inverse bind matrices, one more than it has joints. The second one has none.
+	std::vector<fastgltf::math::fmat4x4> inverseBindMatrices;
+	std::vector<float> inverseBindData;
+	for (std::size_t i = 0; i < 51; ++i) {
+		auto trs = randomTRS(gen);
+		inverseBindMatrices.emplace_back(fastgltf::math::composeTransformMatrix(trs.translation, trs.rotation, trs.scale));
+		inverseBindData.insert(inverseBindData.end(), inverseBindMatrices.back().data(), inverseBindMatrices.back().data() + 16);
+	}
+	auto& skin = asset.skins.emplace_back();
+	for (std::size_t i = 0; i < 50; ++i)
+		skin.joints.emplace_back(std::uniform_int_distribution<std::size_t>(0, nodeCount - 1)(gen));
+	skin.inverseBindMatrices = addFloatAccessor(asset, inverseBindData, fastgltf::AccessorType::Mat4);
+	auto& secondSkin = asset.skins.emplace_back();
+	for (std::size_t i = 0; i < 20; ++i)
+		secondSkin.joints.emplace_back(i * 3);
+
+	fastgltf::SkinningCache cache(asset);
+	REQUIRE(cache.skinCount() == 2);
+	REQUIRE(cache.totalJointCount() == 70);
+	REQUIRE(cache.jointOffset(1) == 50);
+	REQUIRE(cache.joints(1).size() == 20);
+	REQUIRE(cache.inverseBinds(1)[0] == fastgltf::math::fmat4x4());
+
+	auto requireExpectedJointMatrices = [&](const fastgltf::math::fmat4x4* jointMatrices, std::size_t skinIndex) {
+		const auto& joints = asset.skins[skinIndex].joints;
+		for (std::size_t i = 0; i < joints.size(); ++i) {
+			const auto expected = skinIndex == 0 ? worldMatrices[joints[i]] * inverseBindMatrices[i] : worldMatrices[joints[i]];
+			requireMatricesEqual(jointMatrices[i], expected);
+		}
+	};
+
+	std::vector<fastgltf::math::fmat4x4> jointMatrices(cache.totalJointCount());
+	const fastgltf::span<const fastgltf::math::fmat4x4> worlds(worldMatrices.data(), worldMatrices.size());
+	cache.computeAllJointMatrices(worlds, fastgltf::span<fastgltf::math::fmat4x4>(jointMatrices.data(), jointMatrices.size()));
+	requireExpectedJointMatrices(jointMatrices.data(), 0);
+	requireExpectedJointMatrices(jointMatrices.data() + cache.jointOffset(1), 1);
+
+	std::vector<fastgltf::math::fmat4x4> skinMatrices(20);
+	cache.computeJointMatrices(1, worlds, fastgltf::span<fastgltf::math::fmat4x4>(skinMatrices.data(), skinMatrices.size()));
+	requireExpectedJointMatrices(skinMatrices.data(), 1);
+
+	std::vector<fastgltf::math::fmat4x4> fallbackMatrices(50);
+	fastgltf::internal::fallback_compute_joint_matrices(worldMatrices.data(), cache.joints(0).data(), cache.inverseBinds(0).data(),
+		50, fallbackMatrices.data());
+	requireExpectedJointMatrices(fallbackMatrices.data(), 0);
+
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_IX86)
+	std::vector<fastgltf::math::fmat4x4> sseMatrices(50);
+	fastgltf::internal::sse4_compute_joint_matrices(worldMatrices.data(), cache.joints(0).data(), cache.inverseBinds(0).data(),
+		50, sseMatrices.data());
+	requireExpectedJointMatrices(sseMatrices.data(), 0);
+#endif
+}